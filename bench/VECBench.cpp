@@ -0,0 +1,417 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: VECBench.cpp
+*	Author: Benjamin Wießneth
+*	Description: Benchmarks VEC on a synthetic VHDL corpus
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "Config.h"
+#include "Converter.h"
+#include "LayoutEngine.h"
+#include "MSG.h"
+#include "OutputGenerator.h"
+#include "VEC.h"
+#include "VHDLEntity.h"
+#include "VHDLParser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Shape of the synthetic corpus
+struct CorpusOptions
+{
+  unsigned int files = 100;
+  unsigned int entitiesPerFile = 1;
+  unsigned int ports = 32;
+  unsigned int generics = 4;
+  unsigned int maxWidth = 32;  // Widest vector port
+  double commentDensity = 0.5; // Probability of a comment per declaration
+  unsigned long long seed = 1;
+};
+
+// Result of a single benchmark
+struct Result
+{
+  std::string name;
+  unsigned int iterations;
+  double minSeconds;
+  double medianSeconds;
+  unsigned long long items; // Files or entities processed per iteration
+  unsigned long long bytes; // Bytes read or produced per iteration
+};
+
+// Output formats and their names in the results
+static const struct
+{
+  const char* name;
+  OutputGenerator::FORMAT format;
+} formats[] = { { "fodg", OutputGenerator::FORMAT::FODG },
+                { "svg", OutputGenerator::FORMAT::SVG },
+                { "png", OutputGenerator::FORMAT::PNG },
+                { "dokuwiki", OutputGenerator::FORMAT::DokuWiki },
+                { "markdown", OutputGenerator::FORMAT::Markdown },
+                { "latex", OutputGenerator::FORMAT::LaTeX } };
+
+// Small deterministic generator, so a seed always yields the same corpus
+class Random
+{
+public:
+  Random(unsigned long long seed)
+    : mState(seed * 6364136223846793005ULL + 1442695040888963407ULL)
+  {}
+
+  unsigned int next(unsigned int range)
+  {
+    mState = mState * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (unsigned int)((mState >> 33) % range);
+  }
+
+  bool chance(double probability) { return next(1000000) < probability * 1e6; }
+
+private:
+  unsigned long long mState;
+};
+
+// Returns a VHDL source file with the configured entities
+static std::string
+generateSource(const CorpusOptions& options, unsigned int file, Random& random)
+{
+  static const char* directions[] = { "in", "out", "inout" };
+  static const char* comments[] = { "Clock enable of the data path",
+                                    "Selects the active channel",
+                                    "Status flag, valid for one cycle",
+                                    "Configuration word" };
+
+  std::ostringstream os;
+  os << "-- Synthetic VEC benchmark source " << file << "\n"
+     << "library ieee;\n"
+     << "use ieee.std_logic_1164.all;\n"
+     << "use ieee.numeric_std.all;\n\n";
+
+  for (unsigned int e = 0; e < options.entitiesPerFile; e++) {
+    std::string name =
+      "bench_" + std::to_string(file) + "_" + std::to_string(e);
+
+    if (random.chance(options.commentDensity))
+      os << "-------------------------------------------------------------\n"
+         << "-- " << name << "\n"
+         << "-------------------------------------------------------------\n";
+    os << "entity " << name << " is\n";
+
+    if (options.generics > 0) {
+      os << "  generic (\n";
+      for (unsigned int g = 0; g < options.generics; g++) {
+        os << "    G_PARAM" << g << " : integer := " << random.next(64)
+           << (g + 1 < options.generics ? ";" : "");
+        if (random.chance(options.commentDensity))
+          os << " -- " << comments[random.next(4)];
+        os << "\n";
+      }
+      os << "  );\n";
+    }
+
+    // Like in the generics the semicolon is written in front of the trailing
+    // comment, otherwise it would be part of the comment
+    os << "  port (\n"
+       << "    clk_i : in std_ulogic;\n"
+       << "    rst_ni : in std_ulogic" << (options.ports > 0 ? ";" : "")
+       << "\n";
+    for (unsigned int p = 0; p < options.ports; p++) {
+      if (random.chance(options.commentDensity / 4))
+        os << "    -- " << comments[random.next(4)] << "\n";
+
+      const char* direction = directions[random.next(3)];
+      os << "    port" << p << "_" << direction[0] << " : " << direction;
+      unsigned int width = random.next(options.maxWidth + 1);
+      if (width > 1)
+        os << " std_ulogic_vector(" << width - 1 << " downto 0)";
+      else
+        os << " std_ulogic";
+      os << (p + 1 < options.ports ? ";" : "");
+      if (random.chance(options.commentDensity))
+        os << " -- " << comments[random.next(4)];
+      os << "\n";
+    }
+    os << "  );\nend entity " << name << ";\n\n"
+       << "architecture rtl of " << name << " is\nbegin\nend architecture;\n\n";
+  }
+
+  return os.str();
+}
+
+// Writes the corpus to directory and returns the file paths
+static std::vector<std::string>
+generateCorpus(const CorpusOptions& options,
+               const std::string& directory,
+               unsigned long long& bytes)
+{
+  std::filesystem::create_directories(directory);
+
+  Random random(options.seed);
+  std::vector<std::string> files;
+  bytes = 0;
+  for (unsigned int i = 0; i < options.files; i++) {
+    std::string path = directory + "/bench_" + std::to_string(i) + ".vhd";
+    std::string source = generateSource(options, i, random);
+    std::ofstream(path, std::ios::binary) << source;
+    bytes += source.size();
+    files.push_back(path);
+  }
+  return files;
+}
+
+// Runs benchmark iterations times. Setup isn't measured
+template<typename Setup, typename Benchmark>
+static Result
+measure(const std::string& name,
+        unsigned int iterations,
+        Setup setup,
+        Benchmark benchmark)
+{
+  std::cerr << "Running " << name << std::endl;
+
+  Result result = { name, iterations, 0, 0, 0, 0 };
+  std::vector<double> seconds;
+  for (unsigned int i = 0; i < iterations; i++) {
+    setup();
+    result.items = 0;
+    result.bytes = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    benchmark(result);
+    seconds.push_back(std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+  }
+
+  std::sort(seconds.begin(), seconds.end());
+  result.minSeconds = seconds.front();
+  result.medianSeconds = seconds[seconds.size() / 2];
+  return result;
+}
+
+// Prints all results as JSON
+static void
+printJSON(std::ostream& os,
+          const CorpusOptions& options,
+          unsigned long long corpusBytes,
+          unsigned int jobs,
+          const std::vector<Result>& results)
+{
+  os << "{\"version\":\"" << VERSION << "\",\"corpus\":{\"files\":"
+     << options.files << ",\"entities_per_file\":" << options.entitiesPerFile
+     << ",\"ports\":" << options.ports << ",\"generics\":" << options.generics
+     << ",\"max_width\":" << options.maxWidth
+     << ",\"comment_density\":" << options.commentDensity
+     << ",\"seed\":" << options.seed << ",\"bytes\":" << corpusBytes
+     << "},\"jobs\":" << jobs << ",\"benchmarks\":[";
+
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& r = results[i];
+    os << (i ? "," : "") << "\n {\"name\":\"" << r.name
+       << "\",\"iterations\":" << r.iterations
+       << ",\"min_s\":" << r.minSeconds << ",\"median_s\":" << r.medianSeconds
+       << ",\"items\":" << r.items << ",\"bytes\":" << r.bytes
+       << ",\"items_per_s\":" << r.items / r.medianSeconds
+       << ",\"mb_per_s\":" << r.bytes / r.medianSeconds / 1e6 << "}";
+  }
+  os << "\n]}" << std::endl;
+}
+
+static void
+printUsage()
+{
+  std::cerr
+    << "VECBench [options]\n"
+    << "  --files N        Number of generated source files (100)\n"
+    << "  --entities N     Entities per file (1)\n"
+    << "  --ports N        Ports per entity besides clock and reset (32)\n"
+    << "  --generics N     Generics per entity (4)\n"
+    << "  --width N        Widest vector port (32)\n"
+    << "  --comments P     Probability of a comment per declaration (0.5)\n"
+    << "  --seed N         Seed of the corpus generator (1)\n"
+    << "  --iterations N   Runs of each benchmark, the median is reported (3)\n"
+    << "  -j N             Jobs of the end-to-end benchmark (1)\n"
+    << "  --dir PATH       Directory of the corpus and output files\n"
+    << "  --generate       Only write the corpus to --dir\n"
+    << "  --output PATH    Write the JSON results to PATH instead of stdout\n";
+}
+
+int
+main(int argc, const char* argv[])
+{
+  CorpusOptions options;
+  unsigned int iterations = 3;
+  unsigned int jobs = 1;
+  bool generateOnly = false;
+  std::string directory =
+    (std::filesystem::temp_directory_path() / "vec-bench").string();
+  std::string outputPath;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = (i + 1 < argc);
+    if (arg == "--generate") {
+      generateOnly = true;
+    } else if (arg == "--files" && hasValue) {
+      options.files = std::stoul(argv[++i]);
+    } else if (arg == "--entities" && hasValue) {
+      options.entitiesPerFile = std::stoul(argv[++i]);
+    } else if (arg == "--ports" && hasValue) {
+      options.ports = std::stoul(argv[++i]);
+    } else if (arg == "--generics" && hasValue) {
+      options.generics = std::stoul(argv[++i]);
+    } else if (arg == "--width" && hasValue) {
+      options.maxWidth = std::stoul(argv[++i]);
+    } else if (arg == "--comments" && hasValue) {
+      options.commentDensity = std::stod(argv[++i]);
+    } else if (arg == "--seed" && hasValue) {
+      options.seed = std::stoull(argv[++i]);
+    } else if (arg == "--iterations" && hasValue) {
+      iterations = std::max(1UL, std::stoul(argv[++i]));
+    } else if (arg == "-j" && hasValue) {
+      jobs = std::stoul(argv[++i]);
+    } else if (arg == "--dir" && hasValue) {
+      directory = argv[++i];
+    } else if (arg == "--output" && hasValue) {
+      outputPath = argv[++i];
+    } else if ((arg == "--help") || (arg == "-h")) {
+      printUsage();
+      return 0;
+    } else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  unsigned long long corpusBytes;
+  std::vector<std::string> files =
+    generateCorpus(options, directory + "/src", corpusBytes);
+  std::cerr << "Generated " << files.size() << " files (" << corpusBytes
+            << " bytes) in " << directory << "/src" << std::endl;
+  if (generateOnly)
+    return 0;
+
+  std::vector<Result> results;
+
+  // Parsing of the source files
+  std::vector<VHDLEntity> entities;
+  results.push_back(measure(
+    "parse", iterations, [&] { entities.clear(); },
+    [&](Result& r) {
+      for (const std::string& file : files) {
+        VHDLParser parser("");
+        parser.parseFile(file);
+        entities.insert(entities.end(),
+                        parser.getEntities().begin(),
+                        parser.getEntities().end());
+        r.items++;
+      }
+      r.bytes = corpusBytes;
+    }));
+
+  // Layout of all entities, shared by the drawing formats
+  std::vector<Layout> layouts;
+  std::vector<Layout> gridLayouts;
+  results.push_back(measure(
+    "layout", iterations,
+    [&] {
+      layouts.clear();
+      gridLayouts.clear();
+    },
+    [&](Result& r) {
+      for (const VHDLEntity& entity : entities) {
+        layouts.push_back(LayoutEngine::compute(entity, false));
+        gridLayouts.push_back(LayoutEngine::compute(entity, true));
+        r.items++;
+      }
+    }));
+
+  // Each renderer on its own, in memory
+  for (const auto& format : formats) {
+    bool grid = OutputGenerator::needsGridLayout(format.format);
+    results.push_back(measure(
+      std::string("render.") + format.name, iterations, [] {},
+      [&](Result& r) {
+        for (size_t i = 0; i < entities.size(); i++) {
+          r.bytes += OutputGenerator::render(format.format,
+                                             entities[i],
+                                             grid ? gridLayouts[i]
+                                                  : layouts[i])
+                       .size();
+          r.items++;
+        }
+      }));
+  }
+
+  // Whole conversion like "VEC -f -s -p -d -m -t", without the build manifest
+  std::string outputDirectory = directory + "/out";
+  for (const char* key : { "FODG", "SVG", "PNG", "DokuWiki", "Markdown",
+                           "LaTeX" }) {
+    cfg.setString(std::string(key) + ".enableExport", "1");
+    cfg.setString(std::string(key) + ".outputPath",
+                  outputDirectory + "/" + key);
+  }
+  cfg.setString("PNG.useLibreOffice", "0");
+  cfg.setString("PATH.cache", "");
+  cfg.resolveSnapshot();
+
+  // Console output of the converter is discarded
+  std::ostringstream discarded;
+  results.push_back(measure(
+    "convert", iterations,
+    [&] { std::filesystem::remove_all(outputDirectory); },
+    [&](Result& r) {
+      MSG::setThreadStream(&discarded);
+      convertFiles(files, jobs);
+      MSG::setThreadStream();
+      discarded.str("");
+      r.items = files.size();
+      r.bytes = corpusBytes;
+    }));
+
+  std::filesystem::remove_all(directory);
+
+  if (outputPath.empty()) {
+    printJSON(std::cout, options, corpusBytes, jobs, results);
+  } else {
+    std::ofstream output(outputPath);
+    printJSON(output, options, corpusBytes, jobs, results);
+    if (!output) {
+      std::cerr << "Can't write " << outputPath << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,246 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: BuildManifest.cpp
+*	Author: Benjamin Wießneth
+*	Description: Records converted source files to skip them in later runs
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "BuildManifest.h"
+#include "MSG.h"
+#include "SourceFile.h"
+#include "VEC.h"
+#include "tools.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// First line of the manifest. Bump the format number if the layout changes
+#define MANIFEST_HEADER "VEC-cache 1"
+
+BuildManifest::BuildManifest(const std::string& filePath,
+                             unsigned long long configHash)
+  : mFilePath(filePath)
+  , mConfigHash(configHash)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "BuildManifest::BuildManifest(" << filePath << ")";
+}
+
+// The manifest consists of lines with tab separated fields:
+//   VEC-cache 1 <tab> version <tab> config hash
+//   source <tab> size <tab> mtime <tab> hash <tab> path
+//   output <tab> path
+// Output lines belong to the preceding source line
+bool
+BuildManifest::load()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "BuildManifest::load()";
+
+  std::ifstream file(mFilePath);
+  if (!file)
+    return false;
+
+  std::ostringstream expected;
+  expected << MANIFEST_HEADER << '\t' << VERSION << '\t' << mConfigHash;
+
+  std::string line;
+  if (!std::getline(file, line) || line != expected.str()) {
+    MSG(LOG_LEVEL::INFO) << "Config or version changed, converting all files";
+    return false;
+  }
+
+  std::lock_guard<std::mutex> guard(mLock);
+  Entry* entry = nullptr;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string type;
+    std::getline(fields, type, '\t');
+
+    if (type == "source") {
+      Entry current;
+      std::string path;
+      fields >> current.source.size >> current.source.modified >>
+        current.source.hash;
+      fields.ignore(1);
+      std::getline(fields, path);
+      if (!fields.fail() && !path.empty()) {
+        entry = &mEntries[path];
+        *entry = current;
+      } else {
+        entry = nullptr;
+      }
+    } else if (type == "output" && entry != nullptr) {
+      std::string path;
+      std::getline(fields, path);
+      entry->outputFiles.push_back(path);
+    }
+  }
+
+  MSG(LOG_LEVEL::INFO) << "Loaded " << mEntries.size()
+                       << " entries from " << mFilePath;
+
+  return true;
+}
+
+bool
+BuildManifest::save()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "BuildManifest::save()";
+
+  std::ostringstream content;
+  content << MANIFEST_HEADER << '\t' << VERSION << '\t' << mConfigHash << '\n';
+
+  {
+    std::lock_guard<std::mutex> guard(mLock);
+    for (const auto& entry : mEntries) {
+      content << "source\t" << entry.second.source.size << '\t'
+              << entry.second.source.modified << '\t'
+              << entry.second.source.hash << '\t' << entry.first << '\n';
+      for (const std::string& output : entry.second.outputFiles)
+        content << "output\t" << output << '\n';
+    }
+  }
+
+  // Replace the old manifest at once, so an interrupted run can't leave a
+  // truncated one behind
+  std::string tempPath = mFilePath + ".tmp";
+  {
+    std::ofstream file(tempPath, std::ios::out | std::ios::trunc);
+    file << content.str();
+    if (!file) {
+      MSG(LOG_LEVEL::WARNING) << "Can't write " << tempPath;
+      return false;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tempPath, mFilePath, ec);
+  if (ec) {
+    MSG(LOG_LEVEL::WARNING) << "Can't write " << mFilePath << " ("
+                            << ec.message() << ")";
+    std::filesystem::remove(tempPath, ec);
+    return false;
+  }
+
+  return true;
+}
+
+bool
+BuildManifest::isUpToDate(const std::string& sourcePath, Source& source)
+{
+  source.size = 0;
+  source.modified = 0;
+  source.hash = 0;
+  if (!stat(sourcePath, source))
+    return false;
+
+  std::unique_lock<std::mutex> guard(mLock);
+  auto found = mEntries.find(sourcePath);
+  if (found == mEntries.end())
+    return false;
+  Entry& entry = found->second;
+  Source recorded = entry.source;
+  std::vector<std::string> outputFiles = entry.outputFiles;
+  guard.unlock();
+
+  // Size and modification time match in most cases, so the content doesn't
+  // have to be read
+  if (source.size != recorded.size)
+    return false;
+  if (source.modified != recorded.modified) {
+    // The file was touched, e.g. by a checkout. Compare the content
+    if (!hash(sourcePath, source) || source.hash != recorded.hash)
+      return false;
+  } else {
+    source.hash = recorded.hash;
+  }
+
+  // Outputs may have been deleted since
+  for (const std::string& output : outputFiles) {
+    std::error_code ec;
+    if (!std::filesystem::exists(output, ec))
+      return false;
+  }
+
+  // Remember the new modification time of touched files
+  if (source.modified != recorded.modified) {
+    guard.lock();
+    mEntries[sourcePath].source = source;
+  }
+
+  return true;
+}
+
+std::vector<std::string>
+BuildManifest::getOutputFiles(const std::string& sourcePath)
+{
+  std::lock_guard<std::mutex> guard(mLock);
+  auto found = mEntries.find(sourcePath);
+  if (found == mEntries.end())
+    return std::vector<std::string>();
+
+  return found->second.outputFiles;
+}
+
+void
+BuildManifest::record(const std::string& sourcePath,
+                      const Source& source,
+                      const std::vector<std::string>& outputFiles)
+{
+  std::lock_guard<std::mutex> guard(mLock);
+  Entry& entry = mEntries[sourcePath];
+  entry.source = source;
+  entry.outputFiles = outputFiles;
+}
+
+bool
+BuildManifest::stat(const std::string& filePath, Source& source)
+{
+  std::error_code ec;
+  source.size = std::filesystem::file_size(filePath, ec);
+  if (ec)
+    return false;
+
+  std::filesystem::file_time_type modified =
+    std::filesystem::last_write_time(filePath, ec);
+  if (ec)
+    return false;
+  source.modified = modified.time_since_epoch().count();
+
+  return true;
+}
+
+bool
+BuildManifest::hash(const std::string& filePath, Source& source)
+{
+  SourceFile file;
+  if (!file.open(filePath))
+    return false;
+
+  source.hash = hashFNV1a(file.getView());
+  return true;
+}
@@ -0,0 +1,99 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: BuildManifest.h
+*	Author: Benjamin Wießneth
+*	Description: Records converted source files to skip them in later runs
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef BUILDMANIFEST_H
+#define BUILDMANIFEST_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Persistent record of the converted source files. Each source is stored with
+// its size, modification time and content hash together with the output
+// files it produced. Sources which didn't change since the last run with the
+// same config are skipped
+class BuildManifest
+{
+public:
+  // State of a source file on disk
+  struct Source
+  {
+    unsigned long long size;
+    long long modified;
+    unsigned long long hash;
+  };
+
+  // Creates a manifest stored at filePath for the given config hash
+  BuildManifest(const std::string& filePath, unsigned long long configHash);
+
+  // Reads the manifest. Entries of a different config or VEC version are
+  // dropped. Returns false if there was no valid manifest
+  bool load();
+
+  // Writes the manifest. Returns false if it couldn't be written
+  bool save();
+
+  // Returns true if sourcePath and its outputs are unchanged since they were
+  // recorded. Otherwise source is set to the current state of the file, which
+  // is passed to record() once the file is converted. The hash is only read
+  // when it has to be compared, else it's 0 and has to be set by the caller
+  // from the content it converts. Thread-safe
+  bool isUpToDate(const std::string& sourcePath, Source& source);
+
+  // Returns the recorded outputs of sourcePath. Thread-safe
+  std::vector<std::string> getOutputFiles(const std::string& sourcePath);
+
+  // Records the outputs of a converted source file. Thread-safe
+  void record(const std::string& sourcePath,
+              const Source& source,
+              const std::vector<std::string>& outputFiles);
+
+private:
+  struct Entry
+  {
+    Source source;
+    std::vector<std::string> outputFiles;
+  };
+
+  // Reads size and modification time of a file. Returns false if it doesn't
+  // exist
+  static bool stat(const std::string& filePath, Source& source);
+
+  // Hashes the content of a file
+  static bool hash(const std::string& filePath, Source& source);
+
+  std::string mFilePath;
+  unsigned long long mConfigHash;
+  std::map<std::string, Entry> mEntries;
+  std::mutex mLock;
+};
+
+#endif
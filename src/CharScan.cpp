@@ -0,0 +1,138 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: CharScan.cpp
+*	Author: Benjamin Wießneth
+*	Description: Vectorized character search used by the parser
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "CharScan.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define CHARSCAN_SSE2
+// AVX2 code is selected at runtime, which needs the GCC/Clang target attribute
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CHARSCAN_AVX2
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Setting bit 5 maps an ASCII uppercase letter onto its lowercase counterpart.
+// Only 'E' and 'e' end up as 'e', so one compare covers both cases.
+static const char caseBit = 0x20;
+
+// Plain loop for the tail of a buffer and for non-x86 targets
+static const char*
+findScalar(const char* first, const char* last, char letter, char c)
+{
+  for (; first != last; ++first) {
+    if (((*first | caseBit) == letter) || (*first == c))
+      return first;
+  }
+  return last;
+}
+
+#ifdef CHARSCAN_SSE2
+// Returns the index of the lowest set bit of a non-zero mask
+static inline unsigned int
+lowestBit(unsigned int mask)
+{
+#ifdef _MSC_VER
+  unsigned long idx;
+  _BitScanForward(&idx, mask);
+  return idx;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+// Compares 16 chars per iteration
+static const char*
+findSSE2(const char* first, const char* last, char letter, char c)
+{
+  const __m128i vCase = _mm_set1_epi8(caseBit);
+  const __m128i vLetter = _mm_set1_epi8(letter);
+  const __m128i vChar = _mm_set1_epi8(c);
+
+  while (last - first >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    __m128i hit =
+      _mm_or_si128(_mm_cmpeq_epi8(_mm_or_si128(block, vCase), vLetter),
+                   _mm_cmpeq_epi8(block, vChar));
+    unsigned int mask = _mm_movemask_epi8(hit);
+    if (mask)
+      return first + lowestBit(mask);
+    first += 16;
+  }
+
+  return findScalar(first, last, letter, c);
+}
+#endif
+
+#ifdef CHARSCAN_AVX2
+// Compares 32 chars per iteration
+__attribute__((target("avx2"))) static const char*
+findAVX2(const char* first, const char* last, char letter, char c)
+{
+  const __m256i vCase = _mm256_set1_epi8(caseBit);
+  const __m256i vLetter = _mm256_set1_epi8(letter);
+  const __m256i vChar = _mm256_set1_epi8(c);
+
+  while (last - first >= 32) {
+    __m256i block =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    __m256i hit =
+      _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_or_si256(block, vCase), vLetter),
+                      _mm256_cmpeq_epi8(block, vChar));
+    unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+    if (mask)
+      return first + __builtin_ctz(mask);
+    first += 32;
+  }
+
+  return findSSE2(first, last, letter, c);
+}
+
+// Checked once, the result doesn't change while the program is running
+static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+const char*
+findLetterOrChar(const char* first, const char* last, char letter, char c)
+{
+#if defined(CHARSCAN_AVX2)
+  if (hasAVX2)
+    return findAVX2(first, last, letter, c);
+  return findSSE2(first, last, letter, c);
+#elif defined(CHARSCAN_SSE2)
+  return findSSE2(first, last, letter, c);
+#else
+  return findScalar(first, last, letter, c);
+#endif
+}
@@ -0,0 +1,43 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: CharScan.h
+*	Author: Benjamin Wießneth
+*	Description: Vectorized character search used by the parser
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef CHARSCAN_H
+#define CHARSCAN_H
+
+#include <cstddef>
+
+// Returns the position of the first char in [first, last) which is either the
+// given letter (compared case-insensitively) or the char c. Returns last if
+// no such char exists. letter has to be a lowercase ASCII letter.
+// Uses AVX2 or SSE2 if available and falls back to a plain loop otherwise.
+const char*
+findLetterOrChar(const char* first, const char* last, char letter, char c);
+
+#endif
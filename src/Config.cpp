@@ -30,6 +30,8 @@
 
 #include "Config.h"
 #include "MSG.h"
+#include "Stats.h"
+#include "tools.h"
 
 // Initialize a 2-dim string array which includes all configuration keys and
 // their default value
@@ -154,17 +156,22 @@ std::string Config::configurationKeys[][2] = {
 
   { "PATH.soffice",
     "C:\\Program Files (x86)\\LibreOffice 4\\program\\soffice.exe" },
+  { "PATH.cache", ".vec-cache" },
 
   { "FODG.enableExport", "1" },
   { "FODG.outputPath", "FODG" },
 
   { "PNG.enableExport", "0" },
   { "PNG.outputPath", "PNG" },
+  { "PNG.useLibreOffice", "0" },
+  { "PNG.dpi", "150" },
 
   { "SVG.enableExport", "0" },
   { "SVG.outputPath", "SVG" }
 };
 
+thread_local const ConfigSnapshot* Config::threadSnapshot = nullptr;
+
 // Initialize global Config object
 // First look for config in the work directory
 // Then in the home directory
@@ -178,6 +185,7 @@ Config cfg(std::vector<std::string>({ "vec.conf",
 Config::Config(std::string fileName)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "Config(std::string fileName)";
+  Stats::Timer timer(Stats::PHASE::CONFIG, true);
 
   // Fill configMap with all default keys and their values
   setDefaultConfigValues();
@@ -197,15 +205,19 @@ Config::Config(std::string fileName)
                             << "\". Using default values.";
   } else {
     // Update the default values with the values found in the config file
-    readConfigValues();
+    readConfigValues(fileName);
     cF.clear();
+    mFileName = fileName;
   }
+
+  resolveSnapshot();
 }
 
 Config::Config(std::vector<std::string> fileNameList)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "Config(std::vector<std::string> fileNameList)";
+  Stats::Timer timer(Stats::PHASE::CONFIG, true);
 
   // Fill configMap with all default keys and their values
   setDefaultConfigValues();
@@ -253,15 +265,35 @@ Config::Config(std::vector<std::string> fileNameList)
     // Check if buffer cF is valid
     if (!(cF.fail() || cF.bad() || cF.str().empty())) {
       // Update the default values with the values found in the config file
-      readConfigValues();
+      readConfigValues(fileName);
       cF.clear();
+      mFileName = fileName;
       MSG(LOG_LEVEL::INFO) << "Using config file at '" + fileName + "'";
 
+      resolveSnapshot();
       return;
     }
   }
   MSG(LOG_LEVEL::WARNING) << "Couldn't open config files!";
   MSG(LOG_LEVEL::WARNING) << "Using default values.";
+
+  resolveSnapshot();
+}
+
+Config::Config(const Config& base,
+               const std::map<std::string, std::string>& values)
+  : configMap(base.configMap)
+  , mFileName(base.mFileName)
+  , mOverrides(base.mOverrides)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "Config(const Config& base, " << values.size() << " values)";
+
+  for (const auto& entry : values)
+    if (hasKey(entry.first))
+      configMap[entry.first] = entry.second;
+
+  resolveSnapshot();
 }
 
 // Create configuration keys and assign the default values
@@ -289,15 +321,15 @@ Config::setDefaultConfigValues()
 std::string
 Config::getString(std::string key)
 {
-  // Update iterator to point to requested key
-  mIt = configMap.find(key);
+  // Get iterator pointing to requested key
+  std::map<std::string, std::string>::const_iterator mIt = configMap.find(key);
 
   // Check if configMap contains requested key
   if (mIt == configMap.end()) {
     // Requested key doesn't exist in configMap. Display an Error and return an
     // empty string
-    std::cout << "Unknown key: " << key << " Returning >(string) \"\"<"
-              << std::endl;
+    MSG::getStream() << "Unknown key: " << key
+                     << " Returning >(string) \"\"<" << std::endl;
     return "";
   } else {
     // If the key exists get its value and return it
@@ -305,25 +337,226 @@ Config::getString(std::string key)
   }
 }
 
+// Check if configMap contains the key
+bool
+Config::hasKey(const std::string& key) const
+{
+  return configMap.find(key) != configMap.end();
+}
+
 void
 Config::setString(std::string key, std::string value)
 {
   configMap[key] = value;
+  mOverrides[key] = value;
+}
+
+// Read the loaded config file again
+bool
+Config::reload()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "Config::reload()";
+  Stats::Timer timer(Stats::PHASE::CONFIG);
+
+  if (mFileName.empty())
+    return false;
+
+  // Editors may truncate the file before writing it, so the current values
+  // are only replaced if the file could be read
+  std::ifstream f(mFileName.c_str());
+  std::stringstream content;
+  if (f)
+    content << f.rdbuf();
+  if (content.fail() || content.bad() || content.str().empty()) {
+    MSG(LOG_LEVEL::WARNING) << "Can't read config file at \"" << mFileName
+                            << "\". Keeping the current values.";
+    return false;
+  }
+
+  configMap.clear();
+  setDefaultConfigValues();
+
+  cF.str(content.str());
+  readConfigValues(mFileName);
+  cF.clear();
+
+  // Program options override the values of the config file
+  for (const auto& entry : mOverrides)
+    configMap[entry.first] = entry.second;
+
+  resolveSnapshot();
+  return true;
+}
+
+// Use a different snapshot for the calling thread
+void
+Config::setThreadSnapshot(const ConfigSnapshot* snapshot)
+{
+  threadSnapshot = snapshot;
+}
+
+// Resolve the typed snapshot from configMap
+void
+Config::resolveSnapshot()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "Config::resolveSnapshot()";
+
+  ConfigSnapshot& s = mSnapshot;
+
+  s.resetName = getString("resetName");
+  s.clockName = getString("clockName");
+
+  s.highActiveSuffix = getString("HIGHActiveSuffix");
+  s.lowActiveSuffix = getString("LOWActiveSuffix");
+
+  s.verticalMargin = getDouble("vertical_Margin");
+  s.horizontalMargin = getDouble("horizontal_Margin");
+  s.fixedWidth = getDouble("fixedWidth");
+
+  s.labelFont = resolveFont("label");
+  s.entityFont = resolveFont("entity");
+  s.portFont = resolveFont("port");
+  s.vectorFont = resolveFont("vector");
+  s.genericSignalFont = resolveFont("genericSignal");
+
+  s.labelShape = resolveShape("label");
+  s.entityShape = resolveShape("entity");
+  s.portShape = resolveShape("port");
+  s.connectorShape = resolveShape("connector");
+  s.genericsShape = resolveShape("generics");
+  s.genericSignalShape = resolveShape("genericSignal");
+
+  s.dokuWikiExport = resolveExport("DokuWiki");
+  s.markdownExport = resolveExport("Markdown");
+  s.laTeXExport = resolveExport("LaTeX");
+  s.fodgExport = resolveExport("FODG");
+  s.pngExport = resolveExport("PNG");
+  s.svgExport = resolveExport("SVG");
+
+  s.png.useLibreOffice = getBool("PNG.useLibreOffice");
+  s.png.dpi = getDouble("PNG.dpi");
+  if (s.png.dpi <= 0) {
+    MSG(LOG_LEVEL::WARNING) << "Invalid PNG.dpi. Using 150 dpi.";
+    s.png.dpi = 150;
+  }
+  s.png.sofficePath = getString("PATH.soffice");
+
+  s.table.exportType = getBool("Table.exportType");
+  s.table.exportDirection = getBool("Table.exportDirection");
+  s.table.exportPolarity = getBool("Table.exportPolarity");
+  s.table.exportDescription = getBool("Table.exportDescription");
+  s.table.exportBlank1 = getBool("Table.exportBlank1");
+  s.table.exportBlank2 = getBool("Table.exportBlank2");
+  s.table.exportGenerics = getBool("Table.exportGenerics");
+  s.table.combineNameAndType = getBool("Table.combineNameAndType");
+  s.table.arrayNotation = getBool("Table.arrayNotation");
+  s.table.showArrayLength = getBool("Table.showArrayLength");
+  s.table.boldHeadings = getBool("Table.boldHeadings");
+  s.table.centeredHeadings = getBool("Table.centeredHeadings");
+  s.table.centeredName = getBool("Table.centeredName");
+  s.table.centeredType = getBool("Table.centeredType");
+  s.table.centeredDirection = getBool("Table.centeredDirection");
+  s.table.centeredPolarity = getBool("Table.centeredPolarity");
+  s.table.centeredDescription = getBool("Table.centeredDescription");
+  s.table.centeredBlank = getBool("Table.centeredBlank");
+  s.table.centeredGenericName = getBool("Table.centeredGenericName");
+  s.table.centeredGenericType = getBool("Table.centeredGenericType");
+  s.table.centeredGenericDefaultValue =
+    getBool("Table.centeredGenericDefaultValue");
+
+  s.table.nameHeading = getString("Table.Name_heading");
+  s.table.typeHeading = getString("Table.Type_heading");
+  s.table.directionHeading = getString("Table.Direction_heading");
+  s.table.polarityHeading = getString("Table.Polarity_heading");
+  s.table.descriptionHeading = getString("Table.Description_heading");
+  s.table.blank1Heading = getString("Table.Blank1_heading");
+  s.table.blank2Heading = getString("Table.Blank2_heading");
+  s.table.genericName = getString("Table.GenericName");
+  s.table.genericType = getString("Table.GenericType");
+  s.table.genericDefaultValue = getString("Table.GenericDefaultValue");
+
+  s.table.captionHIGHactive = getString("Table.caption_HIGHactive");
+  s.table.captionLOWactive = getString("Table.caption_LOWactive");
+
+  s.latex.addTable = getBool("LaTeX.addTable");
+  s.latex.centering = getBool("LaTeX.centering");
+  s.latex.caption = getBool("LaTeX.caption");
+  s.latex.label = getBool("LaTeX.label");
+
+  // Program option, only present once the program arguments were parsed
+  s.fsync = (configMap.find("VEC.fsync") != configMap.end()) &&
+            getBool("VEC.fsync");
+
+  s.cachePath = getString("PATH.cache");
+
+  // Program options, only present once the program arguments were parsed
+  s.depFilePath = (configMap.find("VEC.MF") != configMap.end())
+                    ? getString("VEC.MF")
+                    : "";
+  s.depFiles = !s.depFilePath.empty() ||
+               ((configMap.find("VEC.MD") != configMap.end()) &&
+                getBool("VEC.MD"));
+
+  // Program options and paths of VEC itself don't change the output
+  s.hash = hashFNV1a("");
+  for (const auto& entry : configMap) {
+    if (entry.first.compare(0, 4, "VEC.") == 0 ||
+        entry.first == "PATH.cache" || entry.first == "PATH.config")
+      continue;
+    s.hash = hashFNV1a(entry.first, s.hash);
+    s.hash = hashFNV1a("=", s.hash);
+    s.hash = hashFNV1a(entry.second, s.hash);
+    s.hash = hashFNV1a("\n", s.hash);
+  }
+}
+
+ConfigSnapshot::Font
+Config::resolveFont(const std::string& prefix)
+{
+  ConfigSnapshot::Font font;
+  font.family = getString(prefix + ".fontFamily");
+  font.size = getString(prefix + ".fontSize");
+  font.weight = getString(prefix + ".fontWeight");
+  font.sizeValue = getDouble(prefix + ".fontSize");
+  font.metrics = &FontMetrics::get(font.family, font.weight);
+  return font;
+}
+
+ConfigSnapshot::Shape
+Config::resolveShape(const std::string& prefix)
+{
+  ConfigSnapshot::Shape shape;
+  shape.stroke = getString(prefix + ".stroke");
+  shape.strokeWidth = getString(prefix + ".strokeWidth");
+  shape.strokeColor = getString(prefix + ".strokeColor");
+  shape.fill = getString(prefix + ".fill");
+  shape.fillColor = getString(prefix + ".fillColor");
+  shape.strokeWidthValue = getDouble(prefix + ".strokeWidth");
+  return shape;
+}
+
+ConfigSnapshot::Export
+Config::resolveExport(const std::string& prefix)
+{
+  ConfigSnapshot::Export exp;
+  exp.enable = getBool(prefix + ".enableExport");
+  exp.outputPath = getString(prefix + ".outputPath");
+  return exp;
 }
 
 // Get requested bool value from configMap
 bool
 Config::getBool(std::string key)
 {
-  // Update iterator to point to requested key
-  mIt = configMap.find(key);
+  // Get iterator pointing to requested key
+  std::map<std::string, std::string>::const_iterator mIt = configMap.find(key);
 
   // Check if configMap contains requested key
   if (mIt == configMap.end()) {
     // Requested key doesn't exist in configMap. Display an Error and return
     // false
-    std::cout << "Unknown key: " << key << " Returning >(bool) false<"
-              << std::endl;
+    MSG::getStream() << "Unknown key: " << key
+                     << " Returning >(bool) false<" << std::endl;
     return false;
   } else {
     // If the key exists get its value and check if its either "1" or "true" and
@@ -343,13 +576,14 @@ Config::getBool(std::string key)
 int
 Config::getInt(std::string key)
 {
-  // Update iterator to point to requested key
-  mIt = configMap.find(key);
+  // Get iterator pointing to requested key
+  std::map<std::string, std::string>::const_iterator mIt = configMap.find(key);
 
   // Check if configMap contains requested key
   if (mIt == configMap.end()) {
     // Requested key doesn't exist in configMap. Display an Error and return -1
-    std::cout << "Unknown key: " << key << " Returning >(int) -1<" << std::endl;
+    MSG::getStream() << "Unknown key: " << key
+                     << " Returning >(int) -1<" << std::endl;
     return -1;
   } else {
     // If the key exists get its value and convert the string to an integer type
@@ -361,14 +595,14 @@ Config::getInt(std::string key)
 double
 Config::getDouble(std::string key)
 {
-  // Update iterator to point to requested key
-  mIt = configMap.find(key);
+  // Get iterator pointing to requested key
+  std::map<std::string, std::string>::const_iterator mIt = configMap.find(key);
 
   // Check if configMap contains requested key
   if (mIt == configMap.end()) {
     // Requested key doesn't exist in configMap. Display an Error and return 0
-    std::cout << "Unknown key: " << key << " Returning >(double) 0<"
-              << std::endl;
+    MSG::getStream() << "Unknown key: " << key
+                     << " Returning >(double) 0<" << std::endl;
     return 0;
   } else {
     // If the key exists get its value and convert the string to a double type
@@ -380,14 +614,14 @@ Config::getDouble(std::string key)
 float
 Config::getFloat(std::string key)
 {
-  // Update iterator to point to requested key
-  mIt = configMap.find(key);
+  // Get iterator pointing to requested key
+  std::map<std::string, std::string>::const_iterator mIt = configMap.find(key);
 
   // Check if configMap contains requested key
   if (mIt == configMap.end()) {
     // Requested key doesn't exist in configMap. Display an Error and return 0
-    std::cout << "Unknown key: " << key << " Returning >(float) 0<"
-              << std::endl;
+    MSG::getStream() << "Unknown key: " << key
+                     << " Returning >(float) 0<" << std::endl;
     return 0;
   } else {
     // If the key exists get its value and convert the string to a float type
@@ -396,67 +630,59 @@ Config::getFloat(std::string key)
 }
 
 // Reads custom keys and values from VEC.conf and updates the keys in configMap
+// The buffer is tokenized in a single pass. Each line either is empty, a
+// comment starting with '#' or a "key=value" pair. Keys have to match one of
+// the configurationKeys exactly, keys which aren't set keep their default
+// value.
 void
-Config::readConfigValues()
+Config::readConfigValues(const std::string& fileName)
 {
-  // Get number of default key/value pairs
-  int numberOfElements =
-    sizeof(configurationKeys) / sizeof(configurationKeys[0]);
+  std::string line;
+  int lineNumber = 0;
 
-  // Loop through all key/value pairs
-  for (int i = 0; i < numberOfElements; i++) {
-    // Get current key
-    std::string currentKey = configurationKeys[i][0];
-
-    // Get the value of current key
-    std::string currentValue = readValueString(configurationKeys[i][0]);
-
-    // Update or add the current key/value pair
-    configMap[currentKey] = currentValue;
-  }
-}
-
-// Reads string value from requested configuration key
-std::string
-Config::readValueString(std::string key)
-{
-  std::string line = "";
   // Clear ctrl-flags of the buffer and set the get pointer to the beginning
   cF.clear();
   cF.seekg(0, cF.beg);
 
   // Loop through all lines of the buffer
   while (getline(cF, line)) {
-    // Find position of keyword
-    int kPos = line.find(key);
-    // Check if the key was found
-    if (kPos != -1) {
-      // Extract contents from the beginning to the occurence of the key
-      // This substring could declare the line as a comment
-      std::string potComment =
-        line.substr(0, kPos); // aquire string between keyword and line break
-      // Check if substring contains comment indicating char
-      if (potComment.find("#") ==
-          std::string::npos) // found no comment in string
-      {
-        // Extract value after the "="
-        std::string val = "";
-        size_t fpos = line.find('=');
-        if (fpos < line.length() - 1)
-          val = line.substr(fpos + 1);
-        else
-          return "";
-
-        // Strip CR and LF from val
-        while ((val[val.length() - 1] == '\n') ||
-               (val[val.length() - 1] == '\r'))
-          val.erase(val.size() - 1);
-
-        // val.erase(std::remove(val.begin(), val.end(), '\n'), val.end());
-
-        return val;
-      }
+    lineNumber++;
+
+    // Strip CR and LF from line
+    while (!line.empty() &&
+           ((line[line.length() - 1] == '\n') ||
+            (line[line.length() - 1] == '\r')))
+      line.erase(line.size() - 1);
+
+    // Skip empty lines and comments
+    size_t first = line.find_first_not_of(" \t");
+    if ((first == std::string::npos) || (line[first] == '#'))
+      continue;
+
+    // Split line at the first "="
+    size_t fpos = line.find('=');
+    if (fpos == std::string::npos) {
+      MSG(LOG_LEVEL::WARNING) << "Ignoring invalid line " << lineNumber
+                              << " in config file '" << fileName << "'";
+      continue;
     }
+
+    // Strip blanks and tabs around the key
+    size_t last = line.find_last_not_of(" \t", fpos - 1);
+    std::string key;
+    if ((fpos > first) && (last != std::string::npos))
+      key = line.substr(first, last - first + 1);
+
+    // Only keys which are known are accepted
+    std::map<std::string, std::string>::iterator mIt = configMap.find(key);
+    if (mIt == configMap.end()) {
+      MSG(LOG_LEVEL::WARNING) << "Unknown key '" << key << "' in line "
+                              << lineNumber << " of config file '" << fileName
+                              << "'";
+      continue;
+    }
+
+    // Value is everything after the "="
+    mIt->second = line.substr(fpos + 1);
   }
-  return "";
 }
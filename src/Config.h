@@ -31,6 +31,8 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include "FontMetrics.h"
+
 #include <algorithm> // transform()
 #include <fstream>   // File input
 #include <iostream>  // Generic IO
@@ -39,6 +41,149 @@
 #include <string>    // std::string
 #include <vector>    // std::vec
 
+// Typed copy of the configuration values used by the output generators.
+// Config::resolveSnapshot() fills it once all program options are set, so
+// generators can read plain fields instead of looking up keys in configMap.
+struct ConfigSnapshot
+{
+  // Font of a text class, e.g. "port.fontFamily"
+  struct Font
+  {
+    std::string family;
+    std::string size;
+    std::string weight;
+    double sizeValue;           // size converted to a number
+    const FontMetrics* metrics; // Glyph widths of family and weight
+  };
+
+  // Stroke and fill of a shape class, e.g. "port.strokeColor"
+  struct Shape
+  {
+    std::string stroke;
+    std::string strokeWidth;
+    std::string strokeColor;
+    std::string fill;
+    std::string fillColor;
+    double strokeWidthValue; // strokeWidth converted to a number
+  };
+
+  // "<Format>.enableExport" and "<Format>.outputPath"
+  struct Export
+  {
+    bool enable;
+    std::string outputPath;
+  };
+
+  // "Table.*" settings shared by DokuWiki, Markdown and LaTeX
+  struct Table
+  {
+    bool exportType;
+    bool exportDirection;
+    bool exportPolarity;
+    bool exportDescription;
+    bool exportBlank1;
+    bool exportBlank2;
+    bool exportGenerics;
+    bool combineNameAndType;
+    bool arrayNotation;
+    bool showArrayLength;
+    bool boldHeadings;
+    bool centeredHeadings;
+    bool centeredName;
+    bool centeredType;
+    bool centeredDirection;
+    bool centeredPolarity;
+    bool centeredDescription;
+    bool centeredBlank;
+    bool centeredGenericName;
+    bool centeredGenericType;
+    bool centeredGenericDefaultValue;
+
+    std::string nameHeading;
+    std::string typeHeading;
+    std::string directionHeading;
+    std::string polarityHeading;
+    std::string descriptionHeading;
+    std::string blank1Heading;
+    std::string blank2Heading;
+    std::string genericName;
+    std::string genericType;
+    std::string genericDefaultValue;
+
+    std::string captionHIGHactive;
+    std::string captionLOWactive;
+  };
+
+  // "PNG.*" settings
+  struct PNG
+  {
+    bool useLibreOffice;     // Convert the FODG file with LibreOffice
+    double dpi;              // Resolution of the built-in rasterizer
+    std::string sofficePath; // "PATH.soffice"
+  };
+
+  // "LaTeX.*" settings
+  struct LaTeX
+  {
+    bool addTable;
+    bool centering;
+    bool caption;
+    bool label;
+  };
+
+  // Special ports
+  std::string resetName;
+  std::string clockName;
+
+  // Polarity suffixes of port names
+  std::string highActiveSuffix;
+  std::string lowActiveSuffix;
+
+  // Drawing dimensions
+  double verticalMargin;
+  double horizontalMargin;
+  double fixedWidth;
+
+  Font labelFont;
+  Font entityFont;
+  Font portFont;
+  Font vectorFont;
+  Font genericSignalFont;
+
+  Shape labelShape;
+  Shape entityShape;
+  Shape portShape;
+  Shape connectorShape;
+  Shape genericsShape;
+  Shape genericSignalShape;
+
+  Export dokuWikiExport;
+  Export markdownExport;
+  Export laTeXExport;
+  Export fodgExport;
+  Export pngExport;
+  Export svgExport;
+
+  Table table;
+  PNG png;
+  LaTeX latex;
+
+  // Flush output files to disk before they are closed ("--fsync")
+  bool fsync;
+
+  // Manifest of the incremental build ("PATH.cache"), empty if disabled
+  std::string cachePath;
+
+  // Write a dependency file for each source file ("-MD")
+  bool depFiles;
+
+  // Write the dependencies of all source files to this file ("-MF")
+  std::string depFilePath;
+
+  // Hash of all values which affect the output files
+  unsigned long long hash;
+};
+
 class Config
 {
 public:
@@ -46,6 +191,13 @@ public:
   Config(std::string fileName);
   Config(std::vector<std::string> fileNameList);
 
+  // Creates a copy of base with the given keys set to new values. Unknown
+  // keys are ignored, see hasKey()
+  Config(const Config& base, const std::map<std::string, std::string>& values);
+
+  // The getters below don't modify the object and may be called from several
+  // worker threads once all program options have been set
+
   // Reads bool value from given key.
   bool getBool(std::string key);
 
@@ -61,9 +213,36 @@ public:
   // Reads string value from given key.
   std::string getString(std::string key);
 
+  // Returns true if key is a known config key
+  bool hasKey(const std::string& key) const;
+
   // Adds or updates the value of the requested key
   void setString(std::string key, std::string value);
 
+  // Resolves the typed snapshot from the current values. Has to be called
+  // again after values were changed with setString()
+  void resolveSnapshot();
+
+  // Reads the loaded config file again. Values set with setString() are
+  // kept. Returns false if the file can't be read, the current values are
+  // kept in this case. Must not be called while files are being converted
+  bool reload();
+
+  // Returns the typed snapshot of the configuration. A snapshot set with
+  // setThreadSnapshot() is returned instead for the calling thread
+  const ConfigSnapshot& getSnapshot() const
+  {
+    return threadSnapshot != nullptr ? *threadSnapshot : mSnapshot;
+  };
+
+  // Use snapshot for all getSnapshot() calls of the calling thread, e.g. to
+  // render with different values. Passing nullptr restores the own snapshot
+  static void setThreadSnapshot(const ConfigSnapshot* snapshot = nullptr);
+
+  // Returns the path of the loaded config file, empty if only the default
+  // values are used
+  const std::string& getFileName() const { return mFileName; };
+
 private:
   // Buffer for the config file
   std::stringstream cF;
@@ -74,18 +253,29 @@ private:
   // The map which will hold all config keys/values
   std::map<std::string, std::string> configMap;
 
-  // Iterator to navigate within configMap
-  std::map<std::string, std::string>::iterator mIt;
+  // Typed values resolved from configMap
+  ConfigSnapshot mSnapshot;
+
+  // Path of the loaded config file
+  std::string mFileName;
+
+  // Values set with setString(), e.g. by program options
+  std::map<std::string, std::string> mOverrides;
+
+  // Per-thread snapshot, nullptr if mSnapshot is used
+  static thread_local const ConfigSnapshot* threadSnapshot;
+
+  // Helpers for resolveSnapshot()
+  ConfigSnapshot::Font resolveFont(const std::string& prefix);
+  ConfigSnapshot::Shape resolveShape(const std::string& prefix);
+  ConfigSnapshot::Export resolveExport(const std::string& prefix);
 
   // Adds all default keys and values to configMap
   void setDefaultConfigValues();
 
   // Reads custom keys and values from VEC.conf and updates the keys in
-  // configMap
-  void readConfigValues();
-
-  // Reads a single value from the requested key
-  std::string readValueString(std::string key);
+  // configMap. fileName is only used for diagnostics
+  void readConfigValues(const std::string& fileName);
 
   // 2-dim array to hold all default keys and their values
   static std::string configurationKeys[][2];
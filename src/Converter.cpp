@@ -0,0 +1,372 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Converter.cpp
+*	Author: Benjamin Wießneth
+*	Description: Converts VHDL source files into the enabled output formats
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "Converter.h"
+#include "BuildManifest.h"
+#include "Config.h"
+#include "MSG.h"
+#include "OFileHandler.h"
+#include "OfficeConverter.h"
+#include "OutputGenerator.h"
+#include "SourceDiscovery.h"
+#include "ThreadPool.h"
+#include "VHDLParser.h"
+#include "tools.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+// Parses a single VHDL source file and generates all enabled output files
+bool
+convertFile(const std::string& fileName,
+            std::vector<std::string>* outputFiles,
+            unsigned long long* sourceHash)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "convertFile(" << fileName << ")";
+
+  bool success = false;
+
+  // Check if input argument has a vhdl extension or refers to stdin
+  if ((fileName == "-") || (validFileExtension(fileName) == true)) {
+    MSG::getStream() << "Parsing " << fileName << std::endl;
+
+    // Create parser object and parse the given source file
+    VHDLParser myParser(fileName, sourceHash);
+
+    // The parser already reported why the file can't be read
+    if (myParser.hasFailed())
+      return false;
+
+    // Set the entity label. It's either provided via command line or
+    // defined in VEC.conf
+    myParser.setEntityLabel(cfg.getString("default_label"));
+
+    // Only entities with ports are converted. This skips e.g. testbench
+    // entities which are bundled with the actual design. The entities are
+    // owned by the parser and only referenced from here on
+    std::vector<const VHDLEntity*> entities;
+    for (const VHDLEntity& entity : myParser.getEntities()) {
+      if ((entity.getNumberOfInputs() != 0) ||
+          (entity.getNumberOfOutputs() != 0))
+        entities.push_back(&entity);
+    }
+
+    // Check if parsed entity has ports
+    if (entities.empty()) {
+      MSG(LOG_LEVEL::ERROR) << "Parsed VHDL entity has no valid ports.";
+    } else {
+      // Print short overview of parsed vhdl entities when verbose mode is
+      // active
+      for (unsigned int i = 0; i < entities.size(); i++)
+        entities[i]->printEntityInfo();
+
+      MSG::getStream() << "Generating output files" << std::endl;
+
+      // Create a OutputGenerator object for each entity which takes care of
+      // creating the output files
+      success = true;
+      for (unsigned int i = 0; i < entities.size(); i++) {
+        OutputGenerator mOutputGenerator(fileName, *entities[i]);
+        if (mOutputGenerator.hasFailed())
+          success = false;
+        if (outputFiles != nullptr)
+          outputFiles->insert(outputFiles->end(),
+                              mOutputGenerator.getOutputFiles().begin(),
+                              mOutputGenerator.getOutputFiles().end());
+      }
+    }
+  } else {
+    // Print message if input file is no valid vhdl file
+    MSG(LOG_LEVEL::ERROR) << fileName
+                          << " has no valid vhd extension. Supported "
+                             "extensions are .vhd and .vhdl";
+  }
+
+  return success;
+}
+
+// Result of convertChangedFile()
+enum class CONVERSION
+{
+  CONVERTED,
+  SKIPPED,
+  FAILED
+};
+
+// Converts a single source file unless the build manifest has it recorded as
+// up to date. The paths of the created or recorded output files are added to
+// outputFiles
+static CONVERSION
+convertChangedFile(const std::string& fileName,
+                   BuildManifest* manifest,
+                   std::vector<std::string>& outputFiles)
+{
+  // Input from stdin can't be checked
+  if ((manifest == nullptr) || (fileName == "-")) {
+    if (convertFile(fileName, &outputFiles))
+      return CONVERSION::CONVERTED;
+    return CONVERSION::FAILED;
+  }
+
+  BuildManifest::Source source;
+  if (manifest->isUpToDate(fileName, source)) {
+    MSG(LOG_LEVEL::INFO) << fileName << " is up to date";
+    outputFiles = manifest->getOutputFiles(fileName);
+    return CONVERSION::SKIPPED;
+  }
+
+  // Only completely converted files are recorded, so failed ones are retried.
+  // New and resized sources weren't hashed yet, the parser does it while it
+  // has the content mapped anyway
+  if (!convertFile(fileName,
+                   &outputFiles,
+                   source.hash == 0 ? &source.hash : nullptr))
+    return CONVERSION::FAILED;
+
+  if (source.hash != 0)
+    manifest->record(fileName, source, outputFiles);
+  return CONVERSION::CONVERTED;
+}
+
+// Escapes a path for a make rule
+static std::string
+escapeMakePath(const std::string& path)
+{
+  std::string escaped;
+  for (char c : path) {
+    if (c == ' ' || c == '#')
+      escaped += '\\';
+    else if (c == '$')
+      escaped += '$';
+    escaped += c;
+  }
+  return escaped;
+}
+
+// Returns a make rule with the output files depending on the source file and
+// the loaded config file
+static std::string
+getDependencyRule(const std::string& fileName,
+                  const std::vector<std::string>& outputFiles)
+{
+  std::string rule;
+  for (const std::string& output : outputFiles)
+    rule += (rule.empty() ? "" : " \\\n ") + escapeMakePath(output);
+
+  rule += ": " + escapeMakePath(fileName);
+  if (!cfg.getFileName().empty())
+    rule += " \\\n " + escapeMakePath(cfg.getFileName());
+
+  return rule + "\n";
+}
+
+// Converts a single source file and writes its dependency file if requested.
+// The rule is stored in depRule if all dependencies go to a single file.
+// Returns true if the file was skipped
+static bool
+processFile(const std::string& fileName,
+            BuildManifest* manifest,
+            std::string& depRule)
+{
+  // Messages about this file refer to it
+  MSG::setSourceFile(fileName);
+
+  std::vector<std::string> outputFiles;
+  CONVERSION result = convertChangedFile(fileName, manifest, outputFiles);
+
+  // Without dependency file a failed conversion is run again by make
+  const ConfigSnapshot& settings = cfg.getSnapshot();
+  if (settings.depFiles && (result != CONVERSION::FAILED) &&
+      !outputFiles.empty() && (fileName != "-")) {
+    depRule = getDependencyRule(fileName, outputFiles);
+
+    // foo.vhd => foo.d
+    if (settings.depFilePath.empty()) {
+      std::string depFile = fileName.substr(0, fileName.find_last_of('.'));
+      OFileHandler::writeFile(depFile + ".d", depRule);
+    }
+  }
+
+  MSG::setSourceFile();
+  return result == CONVERSION::SKIPPED;
+}
+
+// Writes the rules of all source files to the "-MF" dependency file
+static void
+writeDependencyFile(const std::deque<std::string>& depRules)
+{
+  const std::string& depFilePath = cfg.getSnapshot().depFilePath;
+  if (depFilePath.empty())
+    return;
+
+  std::string content;
+  for (const std::string& rule : depRules)
+    content += rule;
+
+  OFileHandler::writeFile(depFilePath, content);
+}
+
+// Converts the source files returned by nextFile until it returns false.
+// Returns the number of skipped files
+static unsigned int
+convertSources(const std::function<bool(std::string&)>& nextFile,
+               unsigned int jobs)
+{
+  // Load the outputs recorded by previous runs
+  std::unique_ptr<BuildManifest> manifest;
+  const ConfigSnapshot& settings = cfg.getSnapshot();
+  if (!settings.cachePath.empty()) {
+    manifest.reset(new BuildManifest(settings.cachePath, settings.hash));
+    manifest->load();
+  }
+  std::atomic<unsigned int> skipped(0);
+
+  // Dependency rules of each file for "-MF". Deques keep the addresses of
+  // their elements while further files are added
+  std::deque<std::string> depRules;
+  std::string fileName;
+
+  // Without additional jobs output is printed directly
+  if (jobs == 1) {
+    while (nextFile(fileName)) {
+      depRules.emplace_back();
+      if (processFile(fileName, manifest.get(), depRules.back()))
+        skipped++;
+    }
+    OfficeConverter::convertQueued(jobs);
+    if (manifest)
+      manifest->save();
+    writeDependencyFile(depRules);
+    return skipped;
+  }
+
+  // Console output of each file is collected in its own buffer
+  std::deque<std::ostringstream> outputs;
+  std::deque<bool> finished;
+  std::mutex lock;
+  std::condition_variable fileFinished;
+
+  ThreadPool pool(jobs);
+
+  MSG(LOG_LEVEL::INFO) << "Converting files using "
+                       << pool.getNumberOfThreads() << " jobs";
+
+  // Prints the buffered output in the order of the files. Stops at the first
+  // unfinished file unless wait is set
+  size_t printed = 0;
+  auto printOutputs = [&](bool wait) {
+    while (printed < outputs.size()) {
+      {
+        std::unique_lock<std::mutex> guard(lock);
+        if (!wait && !finished[printed])
+          return;
+        fileFinished.wait(guard, [&] { return finished[printed]; });
+      }
+      MSG::getStream() << outputs[printed].str() << std::flush;
+      outputs[printed].str("");
+      printed++;
+    }
+  };
+
+  // Files are submitted as soon as they're found
+  while (nextFile(fileName)) {
+    size_t i;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      i = outputs.size();
+      outputs.emplace_back();
+      finished.push_back(false);
+      depRules.emplace_back();
+    }
+
+    std::ostringstream* output = &outputs[i];
+    std::string* depRule = &depRules[i];
+    pool.submit([&, output, depRule, i, fileName] {
+      MSG::setThreadStream(output);
+      if (processFile(fileName, manifest.get(), *depRule))
+        skipped++;
+      MSG::setThreadStream();
+
+      std::lock_guard<std::mutex> guard(lock);
+      finished[i] = true;
+      fileFinished.notify_all();
+    });
+
+    printOutputs(false);
+  }
+  printOutputs(true);
+
+  // PNG files requested from LibreOffice are converted in one batch
+  OfficeConverter::convertQueued(jobs);
+
+  if (manifest)
+    manifest->save();
+  writeDependencyFile(depRules);
+  return skipped;
+}
+
+// Converts all given source files
+unsigned int
+convertFiles(const std::vector<std::string>& fileList, unsigned int jobs)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "convertFiles(" << fileList.size() << " files, " << jobs << " jobs)";
+
+  size_t next = 0;
+  return convertSources(
+    [&](std::string& fileName) {
+      if (next == fileList.size())
+        return false;
+      fileName = fileList[next++];
+      return true;
+    },
+    fileList.size() <= 1 ? 1 : jobs);
+}
+
+// Converts the given files and the source files found in the given
+// directories
+unsigned int
+convertPaths(const std::vector<std::string>& paths, unsigned int jobs)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "convertPaths(" << paths.size() << " paths, " << jobs << " jobs)";
+
+  SourceDiscovery discovery(
+    paths, SourceDiscovery::splitPatterns(cfg.getString("VEC.include")),
+    SourceDiscovery::splitPatterns(cfg.getString("VEC.exclude")));
+  return convertSources(
+    [&](std::string& fileName) { return discovery.next(fileName); }, jobs);
+}
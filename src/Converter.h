@@ -0,0 +1,64 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Converter.h
+*	Author: Benjamin Wießneth
+*	Description: Converts VHDL source files into the enabled output formats
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef CONVERTER_H
+#define CONVERTER_H
+
+#include <string>
+#include <vector>
+
+// Parses a single VHDL source file and generates all enabled output files.
+// The paths of the created files are added to outputFiles if it's given,
+// sourceHash is set to the content hash of the parsed file. Returns false if
+// the file couldn't be converted completely
+bool
+convertFile(const std::string& fileName,
+            std::vector<std::string>* outputFiles = nullptr,
+            unsigned long long* sourceHash = nullptr);
+
+// Converts all given source files. If more than one job is requested the
+// files are processed by a pool of worker threads. Console output is buffered
+// per file and printed in the order of fileList. FODG files queued for the
+// LibreOffice PNG conversion are converted once all files are done. Files
+// which are unchanged according to the build manifest (PATH.cache) are
+// skipped. Make dependency files are written if -MD or -MF is given.
+// Returns the number of skipped files
+unsigned int
+convertFiles(const std::vector<std::string>& fileList, unsigned int jobs);
+
+// Like convertFiles(), but directories in paths are searched recursively for
+// source files (see SourceDiscovery), filtered by the "--include" and
+// "--exclude" patterns. The search runs in the background, so the first files
+// are converted while it continues. A single job converts the files in the
+// calling thread as they're found
+unsigned int
+convertPaths(const std::vector<std::string>& paths, unsigned int jobs);
+
+#endif
@@ -32,21 +32,18 @@
 #include "Config.h"
 #include "MSG.h"
 
-DWMarkup::DWMarkup(VHDLEntity sourceEntity)
-  : OFileHandler(sourceEntity, "DokuWiki", "txt", "markup")
+DWMarkup::DWMarkup(const VHDLEntity& sourceEntity, std::ostream& os)
+  : OFileHandler(sourceEntity, os)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "DWMarkup::DWMarkup(VHDLEntity sourceEntity)";
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mConfigName = " << mConfigName;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mExtension = " << mExtension;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mSuffix = " << mSuffix;
+    << "DWMarkup::DWMarkup(const VHDLEntity& sourceEntity)";
 
   getMaxTextLengths();
 
   getHeader();
   getRows();
 
-  if (cfg.getBool("Table.exportGenerics")) {
+  if (mSettings.table.exportGenerics) {
     getGenerics();
   }
 }
@@ -58,9 +55,9 @@ DWMarkup::Polarity(int i)
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "DWMarkup::Polarity(int i)";
 
   if (mSourceEntity.getLOWActive(i) == true) {
-    return cfg.getString("Table.caption_LOWactive");
+    return mSettings.table.captionLOWactive;
   } else {
-    return cfg.getString("Table.caption_HIGHactive");
+    return mSettings.table.captionHIGHactive;
   }
 }
 
@@ -89,89 +86,89 @@ DWMarkup::getGenerics()
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "DWMarkup::getGenerics()";
 
   if (mSourceEntity.getNumberOfGenerics() > 0) {
-    mOutputFile << std::endl;
-    mOutputFile << std::endl;
+    mOutput << '\n';
+    mOutput << '\n';
 
-    mOutputFile << "^";
+    mOutput << "^";
     std::string outputStr = "";
 
-    if (cfg.getBool("Table.centeredGenericName"))
+    if (mSettings.table.centeredGenericName)
       outputStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       outputStr += "**";
 
-    outputStr += cfg.getString("Table.GenericName");
+    outputStr += mSettings.table.genericName;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       outputStr += "**";
 
-    if (cfg.getBool("Table.centeredGenericName"))
+    if (mSettings.table.centeredGenericName)
       outputStr += " ";
 
     writeCell(colNames::GenericName, outputStr, " ", " ", " ");
-    mOutputFile << "^";
+    mOutput << "^";
     outputStr.clear();
 
-    if (cfg.getBool("Table.centeredGenericType"))
+    if (mSettings.table.centeredGenericType)
       outputStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       outputStr += "**";
 
-    outputStr += cfg.getString("Table.GenericType");
+    outputStr += mSettings.table.genericType;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       outputStr += "**";
 
-    if (cfg.getBool("Table.centeredGenericType"))
+    if (mSettings.table.centeredGenericType)
       outputStr += " ";
 
     writeCell(colNames::GenericType, outputStr, " ", " ", " ");
-    mOutputFile << "^";
+    mOutput << "^";
     outputStr.clear();
 
-    if (cfg.getBool("Table.centeredGenericDefaultValue"))
+    if (mSettings.table.centeredGenericDefaultValue)
       outputStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       outputStr += "**";
 
-    outputStr += cfg.getString("Table.GenericDefaultValue");
+    outputStr += mSettings.table.genericDefaultValue;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       outputStr += "**";
 
-    if (cfg.getBool("Table.centeredGenericDefaultValue"))
+    if (mSettings.table.centeredGenericDefaultValue)
       outputStr += " ";
 
     writeCell(colNames::DefaultValue, outputStr, " ", " ", " ");
-    mOutputFile << "^";
+    mOutput << "^";
     outputStr.clear();
-    mOutputFile << std::endl;
+    mOutput << '\n';
 
     for (int i = 0; i < mSourceEntity.getNumberOfGenerics(); i++) {
-      mOutputFile << "|";
+      mOutput << "|";
 
-      if (cfg.getBool("Table.centeredGenericName"))
+      if (mSettings.table.centeredGenericName)
         outputStr += " ";
 
       outputStr += mSourceEntity.getGenericName(i);
 
-      if (cfg.getBool("Table.centeredGenericName"))
+      if (mSettings.table.centeredGenericName)
         outputStr += " ";
 
       writeCell(colNames::GenericName, outputStr, " ", " ", " ");
       outputStr.clear();
-      mOutputFile << "|";
+      mOutput << "|";
 
-      if (cfg.getBool("Table.centeredGenericType"))
+      if (mSettings.table.centeredGenericType)
         outputStr += " ";
 
       outputStr += mSourceEntity.getGenericType(i);
-      if (cfg.getBool("Table.showArrayLength") &&
+      if (mSettings.table.showArrayLength &&
           mSourceEntity.getGenericIsVector(i)) {
-        if (cfg.getBool("Table.arrayNotation"))
+        if (mSettings.table.arrayNotation)
           outputStr +=
             "[" + std::to_string(mSourceEntity.getGenericVectorLength(i)) + "]";
         else
@@ -180,25 +177,25 @@ DWMarkup::getGenerics()
             std::to_string(mSourceEntity.getGenericVectorEnd(i)) + "]";
       }
 
-      if (cfg.getBool("Table.centeredGenericType"))
+      if (mSettings.table.centeredGenericType)
         outputStr += " ";
 
       writeCell(colNames::GenericType, outputStr, " ", " ", " ");
       outputStr.clear();
-      mOutputFile << "|";
+      mOutput << "|";
 
-      if (cfg.getBool("Table.centeredGenericDefaultValue"))
+      if (mSettings.table.centeredGenericDefaultValue)
         outputStr += " ";
 
       outputStr += mSourceEntity.getGenericDefaultValue(i);
 
-      if (cfg.getBool("Table.centeredGenericDefaultValue"))
+      if (mSettings.table.centeredGenericDefaultValue)
         outputStr += " ";
 
       writeCell(colNames::DefaultValue, outputStr, " ", " ", " ");
       outputStr.clear();
-      mOutputFile << "|";
-      mOutputFile << std::endl;
+      mOutput << "|";
+      mOutput << '\n';
     }
   }
 }
@@ -209,159 +206,159 @@ DWMarkup::getHeader()
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "DWMarkup::getHeader()";
 
-  mOutputFile << "^";
+  mOutput << "^";
   std::string tmpStr = "";
 
-  if (cfg.getBool("Table.centeredName"))
+  if (mSettings.table.centeredName)
     tmpStr += " ";
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     tmpStr += "**";
 
-  tmpStr += cfg.getString("Table.Name_heading");
+  tmpStr += mSettings.table.nameHeading;
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     tmpStr += "**";
 
-  if (cfg.getBool("Table.centeredName"))
+  if (mSettings.table.centeredName)
     tmpStr += " ";
 
   writeCell(colNames::Name, tmpStr, " ", " ", " ");
 
-  mOutputFile << "^";
+  mOutput << "^";
 
-  if ((cfg.getBool("Table.exportType")) &&
-      !cfg.getBool("Table.combineNameAndType")) {
+  if ((mSettings.table.exportType) &&
+      !mSettings.table.combineNameAndType) {
     tmpStr.clear();
 
-    if (cfg.getBool("Table.centeredType"))
+    if (mSettings.table.centeredType)
       tmpStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    tmpStr += cfg.getString("Table.Type_heading");
+    tmpStr += mSettings.table.typeHeading;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    if (cfg.getBool("Table.centeredType"))
+    if (mSettings.table.centeredType)
       tmpStr += " ";
 
     writeCell(colNames::Type, tmpStr, " ", " ", " ");
 
-    mOutputFile << "^";
+    mOutput << "^";
   }
 
-  if (cfg.getBool("Table.exportDirection")) {
+  if (mSettings.table.exportDirection) {
     tmpStr.clear();
-    if (cfg.getBool("Table.centeredDirection"))
+    if (mSettings.table.centeredDirection)
       tmpStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    tmpStr += cfg.getString("Table.Direction_heading");
+    tmpStr += mSettings.table.directionHeading;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    if (cfg.getBool("Table.centeredDirection"))
+    if (mSettings.table.centeredDirection)
       tmpStr += " ";
 
     writeCell(colNames::Direction, tmpStr, " ", " ", " ");
 
-    mOutputFile << "^";
+    mOutput << "^";
   }
 
-  if (cfg.getBool("Table.exportPolarity")) {
+  if (mSettings.table.exportPolarity) {
     tmpStr.clear();
 
-    if (cfg.getBool("Table.centeredPolarity"))
+    if (mSettings.table.centeredPolarity)
       tmpStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    tmpStr += cfg.getString("Table.Polarity_heading");
+    tmpStr += mSettings.table.polarityHeading;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    if (cfg.getBool("Table.centeredPolarity"))
+    if (mSettings.table.centeredPolarity)
       tmpStr += " ";
 
     writeCell(colNames::Polarity, tmpStr, " ", " ", " ");
 
-    mOutputFile << "^";
+    mOutput << "^";
   }
 
-  if (cfg.getBool("Table.exportDescription")) {
+  if (mSettings.table.exportDescription) {
     tmpStr.clear();
 
-    if (cfg.getBool("Table.centeredDescription"))
+    if (mSettings.table.centeredDescription)
       tmpStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    tmpStr += cfg.getString("Table.Description_heading");
+    tmpStr += mSettings.table.descriptionHeading;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    if (cfg.getBool("Table.centeredDescription"))
+    if (mSettings.table.centeredDescription)
       tmpStr += " ";
 
     writeCell(colNames::Description, tmpStr, " ", " ", " ");
 
-    mOutputFile << "^";
+    mOutput << "^";
   }
 
-  if (cfg.getBool("Table.exportBlank1")) {
+  if (mSettings.table.exportBlank1) {
     tmpStr.clear();
 
-    if (cfg.getBool("Table.centeredBlank"))
+    if (mSettings.table.centeredBlank)
       tmpStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    tmpStr += cfg.getString("Table.Blank1_heading");
+    tmpStr += mSettings.table.blank1Heading;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    if (cfg.getBool("Table.centeredBlank"))
+    if (mSettings.table.centeredBlank)
       tmpStr += " ";
 
     writeCell(colNames::Blank, tmpStr, " ", " ", " ");
 
-    mOutputFile << "^";
+    mOutput << "^";
   }
 
-  if (cfg.getBool("Table.exportBlank2")) {
+  if (mSettings.table.exportBlank2) {
     tmpStr.clear();
 
-    if (cfg.getBool("Table.centeredBlank"))
+    if (mSettings.table.centeredBlank)
       tmpStr += " ";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    tmpStr += cfg.getString("Table.Blank2_heading");
+    tmpStr += mSettings.table.blank2Heading;
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       tmpStr += "**";
 
-    if (cfg.getBool("Table.centeredBlank"))
+    if (mSettings.table.centeredBlank)
       tmpStr += " ";
 
     writeCell(colNames::Blank, tmpStr, " ", " ", " ");
 
-    mOutputFile << "^";
+    mOutput << "^";
   }
-  mOutputFile << "\n";
+  mOutput << "\n";
 }
 
 // Generate the table content
@@ -378,85 +375,85 @@ DWMarkup::getRows()
   for (int i = 0; i < noPorts; i++) {
     std::string outputString = "";
     // Create DokuWiki rows
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.centeredName"))
+    if (mSettings.table.centeredName)
       outputString = " ";
 
     outputString += mSourceEntity.getPortName(i);
 
-    if (cfg.getBool("Table.showArrayLength") && mSourceEntity.isVector(i) &&
-        cfg.getBool("Table.combineNameAndType")) {
-      if (cfg.getBool("Table.arrayNotation"))
+    if (mSettings.table.showArrayLength && mSourceEntity.isVector(i) &&
+        mSettings.table.combineNameAndType) {
+      if (mSettings.table.arrayNotation)
         outputString += "[" + mSourceEntity.getVectorStr(i) + "]";
       else
         outputString += "[" + mSourceEntity.getVectorStartStr(i) + ":" +
                         mSourceEntity.getVectorEndStr(i) + "]";
     }
 
-    if (cfg.getBool("Table.centeredName"))
+    if (mSettings.table.centeredName)
       outputString += " ";
 
     writeCell(colNames::Name, outputString, " ", " ", " ");
     outputString.clear();
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if ((cfg.getBool("Table.exportType")) &&
-        !cfg.getBool("Table.combineNameAndType")) {
-      if (cfg.getBool("Table.centeredType"))
+    if ((mSettings.table.exportType) &&
+        !mSettings.table.combineNameAndType) {
+      if (mSettings.table.centeredType)
         outputString = " ";
 
       outputString += Type(i);
 
-      if (cfg.getBool("Table.showArrayLength") && mSourceEntity.isVector(i) &&
-          !cfg.getBool("Table.combineNameAndType")) {
-        if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.showArrayLength && mSourceEntity.isVector(i) &&
+          !mSettings.table.combineNameAndType) {
+        if (mSettings.table.arrayNotation)
           outputString += "[" + mSourceEntity.getVectorStr(i) + "]";
         else
           outputString += "[" + mSourceEntity.getVectorStartStr(i) + ":" +
                           mSourceEntity.getVectorEndStr(i) + "]";
       }
 
-      if (cfg.getBool("Table.centeredType"))
+      if (mSettings.table.centeredType)
         outputString += " ";
 
       writeCell(colNames::Type, outputString, " ", " ", " ");
       outputString.clear();
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    if (cfg.getBool("Table.exportDirection")) {
-      if (cfg.getBool("Table.centeredDirection"))
+    if (mSettings.table.exportDirection) {
+      if (mSettings.table.centeredDirection)
         writeCell(colNames::Direction, Direction(i), "  ", "  ", " ");
       else
         writeCell(colNames::Direction, Direction(i), " ", " ", " ");
 
-      mOutputFile << "|";
+      mOutput << "|";
     }
-    if (cfg.getBool("Table.exportPolarity")) {
-      if (cfg.getBool("Table.centeredPolarity"))
+    if (mSettings.table.exportPolarity) {
+      if (mSettings.table.centeredPolarity)
         writeCell(colNames::Polarity, Polarity(i), "  ", "  ", " ");
       else
         writeCell(colNames::Polarity, Polarity(i), " ", " ", " ");
 
-      mOutputFile << "|";
+      mOutput << "|";
     }
-    if (cfg.getBool("Table.exportDescription")) {
-      if (cfg.getBool("Table.centeredDescription"))
+    if (mSettings.table.exportDescription) {
+      if (mSettings.table.centeredDescription)
         writeCell(colNames::Description, " ", "  ", "  ", " ");
       else
         writeCell(colNames::Description, " ", "", "", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
-    if (cfg.getBool("Table.exportBlank1")) {
-      mOutputFile << " ";
-      mOutputFile << "|";
+    if (mSettings.table.exportBlank1) {
+      mOutput << " ";
+      mOutput << "|";
     }
-    if (cfg.getBool("Table.exportBlank2")) {
-      mOutputFile << " ";
-      mOutputFile << "|";
+    if (mSettings.table.exportBlank2) {
+      mOutput << " ";
+      mOutput << "|";
     }
-    mOutputFile << "\n";
+    mOutput << "\n";
   }
 }
 
@@ -485,9 +482,9 @@ DWMarkup::getMaxTextLengths()
     colWidthType = max(colWidthType, mSourceEntity.getPortTypeStr(i).length());
 
     if (mSourceEntity.isVector(i)) {
-      if (cfg.getBool("Table.showArrayLength")) {
-        if (cfg.getBool("Table.combineNameAndType")) {
-          if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.showArrayLength) {
+        if (mSettings.table.combineNameAndType) {
+          if (mSettings.table.arrayNotation)
             colWidthName = max(colWidthName,
                                mSourceEntity.getPortName(i).length() +
                                  mSourceEntity.getVectorStr(i).length() + 2);
@@ -496,8 +493,8 @@ DWMarkup::getMaxTextLengths()
                                mSourceEntity.getPortName(i).length() +
                                  mSourceEntity.getVectorStartStr(i).length() +
                                  mSourceEntity.getVectorEndStr(i).length() + 3);
-        } else if (cfg.getBool("Table.exportType")) {
-          if (cfg.getBool("Table.arrayNotation"))
+        } else if (mSettings.table.exportType) {
+          if (mSettings.table.arrayNotation)
             colWidthType = max(colWidthType,
                                mSourceEntity.getPortTypeStr(i).length() +
                                  mSourceEntity.getVectorStr(i).length() + 2);
@@ -520,50 +517,50 @@ DWMarkup::getMaxTextLengths()
       max(colWidthGenericType, mSourceEntity.getGenericType(i).length());
   }
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     formattingCorrection = 4;
 
   colWidthName =
-    max(colWidthName + (cfg.getBool("Table.centeredName") ? 2 : 0),
-        cfg.getString("Table.Name_heading").length() + formattingCorrection +
-          (cfg.getBool("Table.centeredName") ? 2 : 0));
+    max(colWidthName + (mSettings.table.centeredName ? 2 : 0),
+        mSettings.table.nameHeading.length() + formattingCorrection +
+          (mSettings.table.centeredName ? 2 : 0));
   colWidthType =
-    max(colWidthType + (cfg.getBool("Table.centeredType") ? 2 : 0),
-        cfg.getString("Table.Type_heading").length() + formattingCorrection +
-          (cfg.getBool("Table.centeredType") ? 2 : 0));
+    max(colWidthType + (mSettings.table.centeredType ? 2 : 0),
+        mSettings.table.typeHeading.length() + formattingCorrection +
+          (mSettings.table.centeredType ? 2 : 0));
   colWidthDirection = max(
-    colWidthDirection + (cfg.getBool("Table.centeredDirection") ? 2 : 0),
-    cfg.getString("Table.Direction_heading").length() + formattingCorrection +
-      (cfg.getBool("Table.centeredDirection") ? 2 : 0));
+    colWidthDirection + (mSettings.table.centeredDirection ? 2 : 0),
+    mSettings.table.directionHeading.length() + formattingCorrection +
+      (mSettings.table.centeredDirection ? 2 : 0));
   colWidthPolarity = max(
-    colWidthPolarity + (cfg.getBool("Table.centeredPolarity") ? 2 : 0),
-    cfg.getString("Table.Polarity_heading").length() + formattingCorrection +
-      (cfg.getBool("Table.centeredPolarity") ? 2 : 0));
+    colWidthPolarity + (mSettings.table.centeredPolarity ? 2 : 0),
+    mSettings.table.polarityHeading.length() + formattingCorrection +
+      (mSettings.table.centeredPolarity ? 2 : 0));
   colWidthDescription = max(
-    colWidthDescription + (cfg.getBool("Table.centeredDescription") ? 2 : 0),
-    cfg.getString("Table.Description_heading").length() + formattingCorrection +
-      (cfg.getBool("Table.centeredDescription") ? 2 : 0));
+    colWidthDescription + (mSettings.table.centeredDescription ? 2 : 0),
+    mSettings.table.descriptionHeading.length() + formattingCorrection +
+      (mSettings.table.centeredDescription ? 2 : 0));
   colWidthBlank =
-    max(colWidthBlank + (cfg.getBool("Table.centeredBlank") ? 2 : 0),
-        cfg.getString("Table.Blank1_heading").length() + formattingCorrection +
-          (cfg.getBool("Table.centeredBlank") ? 2 : 0));
+    max(colWidthBlank + (mSettings.table.centeredBlank ? 2 : 0),
+        mSettings.table.blank1Heading.length() + formattingCorrection +
+          (mSettings.table.centeredBlank ? 2 : 0));
   colWidthBlank =
-    max(colWidthBlank + (cfg.getBool("Table.centeredBlank") ? 2 : 0),
-        cfg.getString("Table.Blank2_heading").length() + formattingCorrection +
-          (cfg.getBool("Table.centeredBlank") ? 2 : 0));
+    max(colWidthBlank + (mSettings.table.centeredBlank ? 2 : 0),
+        mSettings.table.blank2Heading.length() + formattingCorrection +
+          (mSettings.table.centeredBlank ? 2 : 0));
   colWidthGenericName = max(
-    colWidthGenericName + (cfg.getBool("Table.centeredGenericName") ? 2 : 0),
-    cfg.getString("Table.Name_heading").length() + formattingCorrection +
-      (cfg.getBool("Table.centeredGenericName") ? 2 : 0));
+    colWidthGenericName + (mSettings.table.centeredGenericName ? 2 : 0),
+    mSettings.table.nameHeading.length() + formattingCorrection +
+      (mSettings.table.centeredGenericName ? 2 : 0));
   colWidthGenericType = max(
-    colWidthGenericType + (cfg.getBool("Table.centeredGenericType") ? 2 : 0),
-    cfg.getString("Table.Type_heading").length() + formattingCorrection +
-      (cfg.getBool("Table.centeredGenericType") ? 2 : 0));
+    colWidthGenericType + (mSettings.table.centeredGenericType ? 2 : 0),
+    mSettings.table.typeHeading.length() + formattingCorrection +
+      (mSettings.table.centeredGenericType ? 2 : 0));
   colWidthDefaultValue =
     max(colWidthDefaultValue +
-          (cfg.getBool("Table.centeredGenericDefaultValue") ? 2 : 0),
+          (mSettings.table.centeredGenericDefaultValue ? 2 : 0),
         std::string("Default value").length() + formattingCorrection +
-          (cfg.getBool("Table.centeredGenericDefaultValue") ? 2 : 0));
+          (mSettings.table.centeredGenericDefaultValue ? 2 : 0));
 
   colWidthName += 2;
   colWidthType += 2;
@@ -637,14 +634,14 @@ DWMarkup::writeCell(colNames column,
       break;
   }
 
-  mOutputFile << prefix;
+  mOutput << prefix;
   textLength += prefix.length();
 
-  mOutputFile << text;
+  mOutput << text;
   textLength += text.length();
 
   if (!formatting) {
-    mOutputFile << suffix;
+    mOutput << suffix;
     textLength += suffix.length();
 
     if (textLength < maxTextLength) {
@@ -653,7 +650,7 @@ DWMarkup::writeCell(colNames column,
 
       for (size_t i = 0; i < maxTextLength - textLength; i++) {
         MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "fillChar";
-        mOutputFile << fillChar;
+        mOutput << fillChar;
       }
     }
   } else {
@@ -664,11 +661,11 @@ DWMarkup::writeCell(colNames column,
       for (size_t i = 0; i < maxTextLength - textLength - suffix.length();
            i++) {
         MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "fillChar";
-        mOutputFile << fillChar;
+        mOutput << fillChar;
       }
     }
 
-    mOutputFile << suffix;
+    mOutput << suffix;
     textLength += suffix.length();
   }
 }
@@ -53,7 +53,8 @@ private:
   std::string Type(int i);      // Get type string of required port
 
 public:
-  DWMarkup(VHDLEntity sourceEntity);
+  // Renders sourceEntity into os
+  DWMarkup(const VHDLEntity& sourceEntity, std::ostream& os);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: DrawingWriter.h
+*	Author: Benjamin Wießneth
+*	Description: Interface for the writers of the entity symbol
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef DRAWINGWRITER_H
+#define DRAWINGWRITER_H
+
+#include <string>
+
+// Target of the symbol drawn by the SVG class. Coordinates and lengths are
+// given in cm, CSSclass selects the style of the element
+class DrawingWriter
+{
+public:
+  virtual ~DrawingWriter() {}
+
+  // Starts a drawing with the given dimensions
+  virtual void header(double width, double height) = 0;
+
+  // Completes the drawing
+  virtual void footer() = 0;
+
+  // Opens or closes a group of elements
+  virtual void group(bool close = false) = 0;
+
+  // Draws a line from (x1, y1) to (x2, y2)
+  virtual void line(double x1,
+                    double y1,
+                    double x2,
+                    double y2,
+                    std::string CSSclass) = 0;
+
+  // Draws a rectangle with its upper left corner at (x, y)
+  virtual void rect(double x,
+                    double y,
+                    double width,
+                    double height,
+                    std::string CSSclass) = 0;
+
+  // Draws a circle around (x, y)
+  virtual void circle(double x,
+                      double y,
+                      double radius,
+                      std::string CSSclass) = 0;
+
+  // Places a string as a text object at given location
+  virtual void text(double x,
+                    double y,
+                    std::string text,
+                    std::string CSSclass) = 0;
+};
+
+#endif
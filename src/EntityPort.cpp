@@ -87,7 +87,7 @@ EntityPort::EntityPort(std::string pLabel,
 
 // Print info about member values
 void
-EntityPort::printPortInfo()
+EntityPort::printPortInfo() const
 {
   // printf("%-20s %-15s %-10s %-10i %-10i
   // %-10i\n",portLabel,portDirectionsLabels[portDirection],portTypesLabels[portType],isClock,isReset,vectorLength);
@@ -123,35 +123,35 @@ EntityPort::setPortLabel(std::string portLabel)
 
 // Returns the port direction
 EntityPort::portDirections
-EntityPort::getPortDirection()
+EntityPort::getPortDirection() const
 {
   return portDirection;
 }
 
 // Returns the port label
-std::string
-EntityPort::getPortLabel()
+const std::string&
+EntityPort::getPortLabel() const
 {
   return portLabel;
 }
 
 // Returns reset property
 bool
-EntityPort::getReset()
+EntityPort::getReset() const
 {
   return isReset;
 }
 
 // Returns clock property
 bool
-EntityPort::getClock()
+EntityPort::getClock() const
 {
   return isClock;
 }
 
 // Returns vector property
 bool
-EntityPort::getVector()
+EntityPort::getVector() const
 {
   if (vectorLength < 0)
     return false;
@@ -161,19 +161,19 @@ EntityPort::getVector()
 
 // Returns vector length
 int
-EntityPort::getVectorLength()
+EntityPort::getVectorLength() const
 {
   return vectorLength;
 }
 
 int
-EntityPort::getVectorStart()
+EntityPort::getVectorStart() const
 {
   return vectorStart;
 }
 
 int
-EntityPort::getVectorEnd()
+EntityPort::getVectorEnd() const
 {
   return vectorEnd;
 }
@@ -191,19 +191,19 @@ EntityPort::setVectorEnd(int end)
 }
 
 bool
-EntityPort::getLOWActive()
+EntityPort::getLOWActive() const
 {
   return LOWActive;
 }
 
-std::string
-EntityPort::getPortType()
+const std::string&
+EntityPort::getPortType() const
 {
   return portTypeStr;
 }
 
 std::string
-EntityPort::getVectorStr()
+EntityPort::getVectorStr() const
 {
   // Check EntityPort's vector length
   // If greater than 0 it's a valid number
@@ -222,16 +222,14 @@ EntityPort::getVectorStr()
 }
 
 std::string
-EntityPort::getVectorRawStr()
+EntityPort::getVectorRawStr() const
 {
   // Check EntityPort's vector length
   // If greater than 0 it's a valid number
   if (vectorLength > 0) {
     // If vector length is greater than "0" it's an valid number
     // Convert the vector length to a string
-    return static_cast<std::ostringstream*>(
-             &(std::ostringstream() << vectorLength))
-      ->str();
+    return std::to_string(vectorLength);
   }
   // If equal to "0" it contains a generic variable
   else if (vectorLength == 0) {
@@ -283,14 +281,14 @@ EntityPort::setVectorStr(std::string vStr)
   vectorStr = vStr;
 }
 
-std::string
-EntityPort::getVectorEndStr()
+const std::string&
+EntityPort::getVectorEndStr() const
 {
   return vEnd;
 }
 
-std::string
-EntityPort::getVectorStartStr()
+const std::string&
+EntityPort::getVectorStartStr() const
 {
   return vStart;
 }
\ No newline at end of file
@@ -88,31 +88,31 @@ public:
   // Prints some information
   // The information is formatted like this:
   // portLabel portDirection* portDirection portType* portType isClock isReset
-  void printPortInfo();
+  void printPortInfo() const;
 
   // Returns the port direction
-  portDirections getPortDirection();
+  portDirections getPortDirection() const;
 
   // Returns the clock property
-  bool getClock();
+  bool getClock() const;
 
   // Returns the reset property
-  bool getReset();
+  bool getReset() const;
 
   // Returns character pointer to the port name
-  std::string getPortLabel();
+  const std::string& getPortLabel() const;
 
   // Returns the vector property
-  bool getVector();
+  bool getVector() const;
 
   // Returns the vector length
-  int getVectorLength();
+  int getVectorLength() const;
 
   // Returns the vector start value
-  int getVectorStart();
+  int getVectorStart() const;
 
   // Returns the vector end value
-  int getVectorEnd();
+  int getVectorEnd() const;
 
   // Set the vector start value
   void setVectorStart(int start);
@@ -121,12 +121,12 @@ public:
   void setVectorEnd(int end);
 
   // Get the port polarity
-  bool getLOWActive();
+  bool getLOWActive() const;
 
   // Get the port type string
-  std::string getPortType();
+  const std::string& getPortType() const;
 
-  std::string getVectorStr();
+  std::string getVectorStr() const;
 
   void setVectorStr(std::string vStr);
 
@@ -134,11 +134,11 @@ public:
 
   void setVectorEndStr(std::string vE);
 
-  std::string getVectorStartStr();
+  const std::string& getVectorStartStr() const;
 
-  std::string getVectorEndStr();
+  const std::string& getVectorEndStr() const;
 
-  std::string getVectorRawStr();
+  std::string getVectorRawStr() const;
 
 private:
   std::string portLabel;        // Name
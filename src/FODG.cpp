@@ -34,180 +34,38 @@
 #include "MSG.h"
 #include <math.h>
 
-FODG::FODG(VHDLEntity sourceEntity)
-  : OFileHandler(sourceEntity, "FODG", "fodg", "")
+FODG::FODG(const VHDLEntity& sourceEntity,
+           const Layout& layout,
+           std::ostream& os)
+  : OFileHandler(sourceEntity, os)
+  , mLayout(layout)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "FODG::FODG(VHDLEntity sourceEntity)";
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mConfigName = " << mConfigName;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mExtension = " << mExtension;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mSuffix = " << mSuffix;
+    << "FODG::FODG(const VHDLEntity& sourceEntity)";
 
-  initValues();
   translate();
 }
 
-void
-FODG::initValues()
-{
-  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "FODG::initValues(VHDLEntity mSourceEntity)";
-  // Initialize global variables
-  groupHeight = 0;
-  entityHeight = 0;
-  genericWidth = 0;
-  genericHeight = 0;
-  originX = 0;
-  originY = 0;
-  clockPort = -1;
-  resetPort = -1;
-  vectorTextLenghtIn = 0;
-  vectorTextLenghtOut = 0;
-
-  // Load custom settings from config file
-  fontSize = cfg.getDouble("port.fontSize");
-  entity_fontSize = cfg.getDouble("entity.fontSize");
-  generics_fontSize = cfg.getDouble("genericSignal.fontSize");
-  clockName = cfg.getString("clockName");
-  resetName = cfg.getString("resetName");
-  fixedWidth = cfg.getDouble("fixedWidth");
-  horizontal_Margin = cfg.getDouble("horizontal_Margin");
-  vertical_Margin = cfg.getDouble("vertical_Margin");
-  //	labelBox_visible = cfg.getBool("labelBox_visible");
-
-  int noInputs = mSourceEntity.getNumberOfInputs();
-  int noOutputs = mSourceEntity.getNumberOfOutputs();
-
-  // Calculate entityHeight depending on total number of ports and the presence
-  // of special ports No clock port and no reset port
-  if ((mSourceEntity.getClockPort() == -1) &&
-      (mSourceEntity.getResetPort() == -1)) {
-    entityHeight = max(noInputs, noOutputs);
-  }
-  // One clock port and no reset port
-  else if ((mSourceEntity.getClockPort() != -1) &&
-           (mSourceEntity.getResetPort() == -1)) {
-    if (noInputs - 1 >= noOutputs)
-      entityHeight = noInputs;
-    else
-      entityHeight = noOutputs;
-  }
-  // No clock port and one reset port
-  else if ((mSourceEntity.getClockPort() == -1) &&
-           (mSourceEntity.getResetPort() != -1)) {
-    if (noInputs - 1 >= noOutputs)
-      entityHeight = noInputs;
-    else
-      entityHeight = noOutputs + 1;
-
-    // Reset connector facing downward => +1
-    groupHeight = 1.0;
-  }
-  // One clock port and one reset port
-  else if ((mSourceEntity.getClockPort() != -1) &&
-           (mSourceEntity.getResetPort() != -1)) {
-    if ((noInputs - 2) >= noOutputs)
-      entityHeight = noInputs;
-    else
-      entityHeight = noOutputs + 1;
-
-    // Reset connector facing downward => +1
-    groupHeight = 1.0;
-  }
-
-  // Add 1cm for entity caption (always present)
-  entityHeight += 1;
-
-  // includes label
-  groupHeight = groupHeight + entityHeight + 1;
-
-  // Calculate the portWidth or use a fixed width
-  if (fixedWidth <= 0) {
-    // Calculate the portWidth depending on the maximum length of the port names
-    // if no config value is given Get longest portname
-    int charCount = 0;
-    for (int i = 0; i < mSourceEntity.getNumberOfInputs(); i++)
-      charCount = max(charCount, (int)mSourceEntity.getPortName(i).length());
-    for (int i = 0; i < mSourceEntity.getNumberOfOutputs(); i++)
-      charCount = max(
-        charCount,
-        (int)mSourceEntity.getPortName(mSourceEntity.getNumberOfInputs() + i)
-          .length());
-
-    portWidth = calcTextWidth(charCount, fontSize);
-    entityWidth =
-      calcTextWidth(mSourceEntity.getEntityName().length(), entity_fontSize);
-
-    // Set entityWidth and portWidth to required size
-    if (2 * portWidth > entityWidth)
-      // 2*portWidth is greater than the entity name
-      entityWidth = 2 * portWidth;
-    else
-      // Width of entity Name is greater than 2*portWidth
-      portWidth = 0.5 * entityWidth;
-  } else {
-    // Use the given port width property from config file
-    entityWidth = fixedWidth;
-    portWidth = entityWidth / 2;
-  }
-
-  // Calculate height and width of the generic box
-  if (mSourceEntity.getNumberOfGenerics() > 0) {
-    // Get longest generic name
-    int charCount = 0;
-    for (int i = 0; i < mSourceEntity.getNumberOfGenerics(); i++)
-      charCount = max(charCount, (int)mSourceEntity.getGenericStr(i).length());
-
-    // genericWidth = floor(charCount*(generics_fontSize*0.03527)*0.7);
-    genericWidth = calcTextWidth(charCount, generics_fontSize);
-
-    genericHeight = mSourceEntity.getNumberOfGenerics() * 0.5;
-    // if (genericHeight <= 1.0)
-    // genericHeight = ;
-  }
-
-  // Get the longest vector length string	on the left side
-  for (int i = 0; i < mSourceEntity.getNumberOfInputs(); i++) {
-    if (mSourceEntity.isVector(i))
-      vectorTextLenghtIn =
-        max(vectorTextLenghtIn,
-            calcTextWidth(mSourceEntity.getVectorStr(i).length(), fontSize));
-  }
-  // If no vector length string is longer than the connector line itself it is
-  // set to 1.0
-  if (vectorTextLenghtIn < 1.0)
-    vectorTextLenghtIn = 1;
-
-  // Get the longest vector length string	on the right side
-  for (int i = 0; i < mSourceEntity.getNumberOfOutputs(); i++) {
-    if (mSourceEntity.isVector(mSourceEntity.getNumberOfInputs() + i))
-      vectorTextLenghtOut =
-        max(vectorTextLenghtOut,
-            calcTextWidth(
-              mSourceEntity.getVectorStr(mSourceEntity.getNumberOfInputs() + i)
-                .length(),
-              fontSize));
-  }
-
-  // If no vector length string is longer than the connector line itself, it is
-  // set to 1.0
-  if (vectorTextLenghtOut < 1.0)
-    vectorTextLenghtOut = 1.0;
-
-  // Calculate origins of the drawing. These coordinates are used for glue
-  // points Half the group height
-  originY = (groupHeight) / 2;
-
-  // Two connectors on each side + rectangle width
-  groupWidth = (2 + entityWidth);
-  originX = groupWidth / 2;
-}
-
 void
 FODG::translate()
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "FODG::translate()";
 
+  // Dimensions of the symbol computed by the LayoutEngine
+  const double entityHeight = mLayout.entityHeight;
+  const double entityWidth = mLayout.entityWidth;
+  const double groupHeight = mLayout.groupHeight;
+  const double originY = mLayout.originY;
+  const double portWidth = mLayout.portWidth;
+  const double genericWidth = mLayout.genericWidth;
+  const double genericHeight = mLayout.genericHeight;
+  const double vectorTextLengthIn = mLayout.vectorTextLengthIn;
+  const double vectorTextLengthOut = mLayout.vectorTextLengthOut;
+  const double horizontal_Margin = mSettings.horizontalMargin;
+  const double vertical_Margin = mSettings.verticalMargin;
+  int clockPort = -1;
+  int resetPort = -1;
+
   // Relative coordinates for gluepoints
   // svg:y = (portY / (entityHeight/2) * resolution * direction) = (1.5cm / 4cm
   // = 0.375cm) * 5 * -1 = -1.875cm
@@ -216,27 +74,27 @@ FODG::translate()
 
   double currentX = 0;
   double currentY = 0;
-  double strokeWidth = cfg.getDouble("entity.strokeWidth");
+  double strokeWidth = mSettings.entityShape.strokeWidthValue;
 
   stringstream ss;
-  FODGWriter sWriter(mOutputFile);
+  FODGWriter sWriter(mOutput);
 
   // Insert FODG header and custom styles
   if (genericWidth > 0) {
     // Entity has generics
-    if (vectorTextLenghtOut > genericWidth) {
+    if (vectorTextLengthOut > genericWidth) {
       // One of the vector length strings is greater than the width of the
       // generic box
       if (mSourceEntity.getResetPort() != -1)
         // Entity has a reset port
         sWriter.FODGHeader(entityWidth + 2 * horizontal_Margin +
-                             vectorTextLenghtIn + vectorTextLenghtOut,
+                             vectorTextLengthIn + vectorTextLengthOut,
                            entityHeight + 1 + genericHeight +
                              2 * vertical_Margin);
       else
         // Entity has no reset port
         sWriter.FODGHeader(entityWidth + 2 * horizontal_Margin +
-                             vectorTextLenghtIn + vectorTextLenghtOut,
+                             vectorTextLengthIn + vectorTextLengthOut,
                            entityHeight + genericHeight + 2 * vertical_Margin);
     } else {
       // Vector length strings are all shorter than than the width of the
@@ -244,13 +102,13 @@ FODG::translate()
       if (mSourceEntity.getResetPort() != -1) {
         // Entity has a reset port
         sWriter.FODGHeader(entityWidth + 2 * horizontal_Margin +
-                             vectorTextLenghtIn + genericWidth,
+                             vectorTextLengthIn + genericWidth,
                            entityHeight + 1 + genericHeight +
                              2 * vertical_Margin);
       } else {
         // Entity has no reset port
         sWriter.FODGHeader(entityWidth + 2 * horizontal_Margin +
-                             vectorTextLenghtIn + genericWidth,
+                             vectorTextLengthIn + genericWidth,
                            entityHeight + genericHeight + 2 * vertical_Margin);
       }
     }
@@ -259,17 +117,17 @@ FODG::translate()
     if (mSourceEntity.getResetPort() != -1)
       // Entity has a reset port
       sWriter.FODGHeader(entityWidth + 2 * horizontal_Margin +
-                           vectorTextLenghtIn + vectorTextLenghtOut,
+                           vectorTextLengthIn + vectorTextLengthOut,
                          entityHeight + 2 + 2 * vertical_Margin);
     else
       // Entity has no reset port
       sWriter.FODGHeader(entityWidth + 2 * horizontal_Margin +
-                           vectorTextLenghtIn + vectorTextLenghtOut,
+                           vectorTextLengthIn + vectorTextLengthOut,
                          entityHeight + 1 + 2 * vertical_Margin);
   }
 
   // Set coordinate to the upper left corner of the label box
-  currentX = horizontal_Margin + vectorTextLenghtIn;
+  currentX = horizontal_Margin + vectorTextLengthIn;
   currentY = vertical_Margin;
 
   if (mSourceEntity.getNumberOfGenerics() > 0) {
@@ -564,24 +422,3 @@ FODG::translate()
   // Insert closing tags
   sWriter.FODGclose();
 }
-
-double
-FODG::calcTextWidth(int charCount, double fontSize)
-{
-  double yOffset = 0.52;
-  double lengthCoeff = 0.0232;
-  double lengthOffset = 0.0069;
-  double adjFactor = 0.95;
-
-  if (charCount == 0)
-    return 0;
-
-  double width =
-    ((lengthCoeff * charCount + lengthOffset) * fontSize + yOffset) * adjFactor;
-  width = floor(width) + 0.5;
-
-  if (width < 1.0)
-    return 1.0;
-  else
-    return width;
-}
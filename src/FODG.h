@@ -30,41 +30,21 @@
 
 #ifndef FODG_H
 #define FODG_H
+#include "LayoutEngine.h"
 #include "OFileHandler.h"
 #include "VHDLEntity.h"
 
 class FODG : OFileHandler
 {
 private:
-  void initValues();
   void translate();
-  double calcTextWidth(int charCount, double fontSize);
 
-  double entityHeight;
-  double entityWidth;
-  double groupHeight;
-  double groupWidth;
-  double originX;
-  double originY;
-  double portWidth;
-  double genericWidth;
-  double genericHeight;
-  double fontSize;
-  double generics_fontSize;
-  double entity_fontSize;
-  double fixedWidth;
-  std::string clockName;
-  std::string resetName;
-  int clockPort;
-  int resetPort;
-  //	std::string default_label;
-  double horizontal_Margin;
-  double vertical_Margin;
-  double vectorTextLenghtIn;
-  double vectorTextLenghtOut;
+  const Layout& mLayout;
 
 public:
-  FODG(VHDLEntity sourceEntity);
+  // Renders sourceEntity with the given layout into os. The layout has to be
+  // grid aligned
+  FODG(const VHDLEntity& sourceEntity, const Layout& layout, std::ostream& os);
 };
 
 #endif
\ No newline at end of file
@@ -40,6 +40,7 @@
 
 FODGWriter::FODGWriter(std::ostream& os)
   : os(os)
+  , mSettings(cfg.getSnapshot())
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "FODGWriter::FODGWriter(ostream& os)";
@@ -63,9 +64,9 @@ FODGWriter::line(double x1,
   os << "\t<draw:line draw:style-name = \"" << shapeID
      << "\" draw:layer = \"layout\" svg:x1 = \"" << x1 << "cm\" svg:y1 = \""
      << y1 << "cm\" svg:x2 = \"" << x2 << "cm\" svg:y2 = \"" << y2 << "cm\">"
-     << std::endl
-     << "\t\t<text:p/>" << std::endl
-     << "\t</draw:line>" << std::endl;
+     << '\n'
+     << "\t\t<text:p/>" << '\n'
+     << "\t</draw:line>" << '\n';
 
   return;
 }
@@ -88,9 +89,9 @@ FODGWriter::group(bool close)
 {
   // pmesg(10,"&FODGWriter::group(bool close)\n");
   if (close)
-    os << "</draw:g>" << std::endl;
+    os << "</draw:g>" << '\n';
   else
-    os << "<draw:g>" << std::endl;
+    os << "<draw:g>" << '\n';
 
   return;
 }
@@ -101,7 +102,7 @@ FODGWriter::gluePoint(double x, double y)
   // pmesg(10,"&FODGWriter::gluePoint(double x, double y)\n");
 
   os << "\t<draw:glue-point draw:id = \"" << gluePointID << "\" svg:x = \"" << x
-     << "cm\" svg:y = \"" << y << "cm\" />" << std::endl;
+     << "cm\" svg:y = \"" << y << "cm\" />" << '\n';
   gluePointID++;
 
   return;
@@ -120,19 +121,19 @@ FODGWriter::customShape(double x,
      << "\" draw:text-style-name = \"" << textID
      << "\" draw:layer = \"layout\" svg:width = \"" << width
      << "cm\"  svg:height = \"" << height << "cm\" svg:x = \"" << x
-     << "cm\" svg:y = \"" << y << "cm\">" << std::endl;
+     << "cm\" svg:y = \"" << y << "cm\">" << '\n';
 
   os << "\t\t<text:p text:style-name = \"" << textID
      << "\"><text:span text:style-name = \"" << textID << "\">" << label
-     << "</text:span></text:p>" << std::endl;
+     << "</text:span></text:p>" << '\n';
 
   os << "\t\t<draw:enhanced-geometry svg:viewBox = \"0 0 500 500\" "
         "draw:mirror-horizontal = \"false\" draw:mirror-vertical = \"false\" "
         "draw:type = \"rectangle\" draw:enhanced-path = \"M 0 0 L 500 0 500 "
         "500 0 500 0 0 Z N\"/>"
-     << std::endl;
+     << '\n';
 
-  os << "\t</draw:custom-shape>" << std::endl;
+  os << "\t</draw:custom-shape>" << '\n';
 
   return;
 }
@@ -141,7 +142,7 @@ void
 FODGWriter::FODGHeader(double width, double height)
 {
   os
-    << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl
+    << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << '\n'
     << "<office:document "
        "xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" "
        "xmlns:style=\"urn:oasis:names:tc:opendocument:xmlns:style:1.0\" "
@@ -186,13 +187,13 @@ FODGWriter::FODGHeader(double width, double height)
        "xmlns:form:1.0\" xmlns:css3t=\"http://www.w3.org/TR/css3-text/\" "
        "office:version=\"1.2\" "
        "office:mimetype=\"application/vnd.oasis.opendocument.graphics\">"
-    << std::endl
-    << "<office:styles>" << std::endl
+    << '\n'
+    << "<office:styles>" << '\n'
     << "<draw:marker draw:name=\"Arrow\" svg:viewBox=\"0 0 20 30\" svg:d=\"m10 "
        "0-10 30h20z\"/>"
-    << std::endl
+    << '\n'
     << "<style:style style:name=\"standard\" style:family=\"graphic\">"
-    << std::endl
+    << '\n'
     << "<style:graphic-properties draw:stroke=\"solid\" "
        "svg:stroke-width=\"0cm\" svg:stroke-color=\"#808080\" "
        "draw:marker-start-width=\"0.2cm\" draw:marker-start-center=\"false\" "
@@ -203,12 +204,12 @@ FODGWriter::FODGHeader(double width, double height)
        "fo:padding-right=\"0.25cm\" draw:shadow=\"hidden\" "
        "draw:shadow-offset-x=\"0.2cm\" draw:shadow-offset-y=\"0.2cm\" "
        "draw:shadow-color=\"#808080\">"
-    << std::endl
-    << "</style:graphic-properties>" << std::endl
+    << '\n'
+    << "</style:graphic-properties>" << '\n'
     << "<style:paragraph-properties fo:margin-left=\"0cm\" "
        "fo:margin-right=\"0cm\" fo:margin-top=\"0cm\" fo:margin-bottom=\"0cm\" "
        "fo:line-height=\"100%\" fo:text-indent=\"0cm\"/>"
-    << std::endl
+    << '\n'
     << "<style:text-properties style:use-window-font-color=\"true\" "
        "style:text-outline=\"false\" style:text-line-through-style=\"none\" "
        "fo:font-family=\"Arial\" style:font-family-generic=\"roman\" "
@@ -227,30 +228,30 @@ FODGWriter::FODGHeader(double width, double height)
        "style:font-weight-complex=\"normal\" style:text-emphasize=\"none\" "
        "style:font-relief=\"none\" style:text-overline-style=\"none\" "
        "style:text-overline-color=\"font-color\"/>"
-    << std::endl
-    << "</style:style>" << std::endl
-    << "</office:styles>" << std::endl;
+    << '\n'
+    << "</style:style>" << '\n'
+    << "</office:styles>" << '\n';
 
   FODGPage(width, height);
   FODGStyles();
 
-  os << "<office:master-styles>" << std::endl
-     << "<draw:layer-set>" << std::endl
-     << "<draw:layer draw:name=\"layout\"/>" << std::endl
-     << "<draw:layer draw:name=\"background\"/>" << std::endl
-     << "<draw:layer draw:name=\"backgroundobjects\"/>" << std::endl
-     << "<draw:layer draw:name=\"controls\"/>" << std::endl
-     << "<draw:layer draw:name=\"measurelines\"/>" << std::endl
-     << "</draw:layer-set>" << std::endl
+  os << "<office:master-styles>" << '\n'
+     << "<draw:layer-set>" << '\n'
+     << "<draw:layer draw:name=\"layout\"/>" << '\n'
+     << "<draw:layer draw:name=\"background\"/>" << '\n'
+     << "<draw:layer draw:name=\"backgroundobjects\"/>" << '\n'
+     << "<draw:layer draw:name=\"controls\"/>" << '\n'
+     << "<draw:layer draw:name=\"measurelines\"/>" << '\n'
+     << "</draw:layer-set>" << '\n'
      << "<style:master-page style:name=\"Standard\" "
         "style:page-layout-name=\"PM0\" draw:style-name=\"dp1\"/>"
-     << std::endl
-     << "</office:master-styles>" << std::endl
-     << "<office:body>" << std::endl
-     << "<office:drawing>" << std::endl
+     << '\n'
+     << "</office:master-styles>" << '\n'
+     << "<office:body>" << '\n'
+     << "<office:drawing>" << '\n'
      << "<draw:page draw:name=\"page1\" draw:style-name=\"dp1\" "
         "draw:master-page-name=\"Standard\">"
-     << std::endl;
+     << '\n';
 
   return;
 }
@@ -258,10 +259,10 @@ FODGWriter::FODGHeader(double width, double height)
 void
 FODGWriter::FODGclose()
 {
-  os << "</draw:page>" << std::endl
-     << "</office:drawing>" << std::endl
-     << "</office:body>" << std::endl
-     << "</office:document>" << std::endl;
+  os << "</draw:page>" << '\n'
+     << "</office:drawing>" << '\n'
+     << "</office:body>" << '\n'
+     << "</office:document>" << '\n';
 
   return;
 }
@@ -272,243 +273,243 @@ FODGWriter::FODGStyles()
   // Shape styles
   // Bounding box
   os
-    << "<!-- Shape formats -->" << std::endl
-    << "<!-- Bounding box -->" << std::endl
+    << "<!-- Shape formats -->" << '\n'
+    << "<!-- Bounding box -->" << '\n'
     << "<style:style style:name=\"entity\" style:family=\"graphic\" "
        "style:parent-style-name=\"standard\">"
-    << std::endl
+    << '\n'
     << "<style:graphic-properties svg:stroke-width=\""
-    << cfg.getString("entity.strokeWidth") << "\" draw:stroke=\""
-    << cfg.getString("entity.stroke") << "\" svg:stroke-color=\""
-    << cfg.getString("entity.strokeColor") << "\" draw:fill=\""
-    << cfg.getString("entity.fill") << "\" draw:fill-color=\""
-    << cfg.getString("entity.fillColor")
+    << mSettings.entityShape.strokeWidth << "\" draw:stroke=\""
+    << mSettings.entityShape.stroke << "\" svg:stroke-color=\""
+    << mSettings.entityShape.strokeColor << "\" draw:fill=\""
+    << mSettings.entityShape.fill << "\" draw:fill-color=\""
+    << mSettings.entityShape.fillColor
     << "\" draw:textarea-horizontal-align=\"justify\" "
        "draw:textarea-vertical-align=\"top\" draw:auto-grow-height=\"false\" />"
-    << std::endl
-    << "</style:style>" << std::endl;
+    << '\n'
+    << "</style:style>" << '\n';
 
   // Port box
-  os << "<!-- port box -->" << std::endl
+  os << "<!-- port box -->" << '\n'
      << "<style:style style:name=\"port\" style:family=\"graphic\" "
         "style:parent-style-name=\"standard\">"
-     << std::endl
+     << '\n'
      << "<style:graphic-properties svg:stroke-width=\""
-     << cfg.getString("port.strokeWidth") << "\" draw:stroke=\""
-     << cfg.getString("port.stroke") << "\" svg:stroke-color=\""
-     << cfg.getString("port.strokeColor") << "\" draw:fill=\""
-     << cfg.getString("port.fill") << "\" draw:fill-color=\""
-     << cfg.getString("port.fillColor")
+     << mSettings.portShape.strokeWidth << "\" draw:stroke=\""
+     << mSettings.portShape.stroke << "\" svg:stroke-color=\""
+     << mSettings.portShape.strokeColor << "\" draw:fill=\""
+     << mSettings.portShape.fill << "\" draw:fill-color=\""
+     << mSettings.portShape.fillColor
      << "\" draw:textarea-horizontal-align=\"justify\" "
         "draw:textarea-vertical-align=\"middle\" "
         "draw:auto-grow-height=\"false\" />"
-     << std::endl
-     << "</style:style>" << std::endl;
+     << '\n'
+     << "</style:style>" << '\n';
 
   // Connector
-  os << "<!-- Connector -->" << std::endl
+  os << "<!-- Connector -->" << '\n'
      << "<style:style style:name=\"connector\" style:family=\"graphic\" "
         "style:parent-style-name=\"standard\">"
-     << std::endl
+     << '\n'
      << "<style:graphic-properties svg:stroke-width=\""
-     << cfg.getString("connector.strokeWidth") << "\" draw:stroke=\""
-     << cfg.getString("connector.stroke") << "\" svg:stroke-color=\""
-     << cfg.getString("connector.strokeColor") << "\" draw:fill=\""
-     << cfg.getString("connector.fill") << "\" draw:fill-color=\""
-     << cfg.getString("connector.fillColor")
+     << mSettings.connectorShape.strokeWidth << "\" draw:stroke=\""
+     << mSettings.connectorShape.stroke << "\" svg:stroke-color=\""
+     << mSettings.connectorShape.strokeColor << "\" draw:fill=\""
+     << mSettings.connectorShape.fill << "\" draw:fill-color=\""
+     << mSettings.connectorShape.fillColor
      << "\" draw:textarea-horizontal-align=\"justify\" "
         "draw:textarea-vertical-align=\"middle\" "
         "draw:auto-grow-height=\"false\" />"
-     << std::endl
-     << "</style:style>" << std::endl;
+     << '\n'
+     << "</style:style>" << '\n';
 
   // Label box
-  os << "<!-- Label box -->" << std::endl
+  os << "<!-- Label box -->" << '\n'
      << "<style:style style:name=\"label\" style:family=\"graphic\" "
         "style:parent-style-name=\"standard\">"
-     << std::endl
+     << '\n'
      << "<style:graphic-properties svg:stroke-width=\""
-     << cfg.getString("label.strokeWidth") << "\" draw:stroke=\""
-     << cfg.getString("label.stroke") << "\" svg:stroke-color=\""
-     << cfg.getString("label.strokeColor") << "\" draw:fill=\""
-     << cfg.getString("label.fill") << "\" draw:fill-color=\""
-     << cfg.getString("label.fillColor")
+     << mSettings.labelShape.strokeWidth << "\" draw:stroke=\""
+     << mSettings.labelShape.stroke << "\" svg:stroke-color=\""
+     << mSettings.labelShape.strokeColor << "\" draw:fill=\""
+     << mSettings.labelShape.fill << "\" draw:fill-color=\""
+     << mSettings.labelShape.fillColor
      << "\" draw:textarea-horizontal-align=\"justify\" "
         "draw:textarea-vertical-align=\"middle\" "
         "draw:auto-grow-height=\"false\" />"
-     << std::endl
-     << "</style:style>" << std::endl;
+     << '\n'
+     << "</style:style>" << '\n';
 
   // VectorLength box
-  os << "<!-- VectorLength box -->" << std::endl
+  os << "<!-- VectorLength box -->" << '\n'
      << "<style:style style:name=\"vectorLength\" style:family=\"graphic\" "
         "style:parent-style-name=\"standard\">"
-     << std::endl
+     << '\n'
      << "<style:graphic-properties svg:stroke-width=\""
-     << cfg.getString("label.strokeWidth")
+     << mSettings.labelShape.strokeWidth
      << "\" draw:stroke=\"none\" draw:fill=\"none\" "
         "draw:textarea-horizontal-align=\"justify\" "
         "draw:textarea-vertical-align=\"middle\" "
         "draw:auto-grow-height=\"false\" />"
-     << std::endl
-     << "</style:style>" << std::endl;
+     << '\n'
+     << "</style:style>" << '\n';
 
   // Generic box
-  os << "<!-- Generic box -->" << std::endl
+  os << "<!-- Generic box -->" << '\n'
      << "<style:style style:name=\"generics\" style:family=\"graphic\" "
         "style:parent-style-name=\"standard\">"
-     << std::endl
+     << '\n'
      << "<style:graphic-properties svg:stroke-width=\""
-     << cfg.getString("generics.strokeWidth") << "\" draw:stroke=\""
-     << cfg.getString("generics.stroke") << "\" svg:stroke-color=\""
-     << cfg.getString("generics.strokeColor") << "\" draw:fill=\""
-     << cfg.getString("generics.fill") << "\" draw:fill-color=\""
-     << cfg.getString("generics.fillColor")
+     << mSettings.genericsShape.strokeWidth << "\" draw:stroke=\""
+     << mSettings.genericsShape.stroke << "\" svg:stroke-color=\""
+     << mSettings.genericsShape.strokeColor << "\" draw:fill=\""
+     << mSettings.genericsShape.fill << "\" draw:fill-color=\""
+     << mSettings.genericsShape.fillColor
      << "\" draw:textarea-horizontal-align=\"justify\" "
         "draw:textarea-vertical-align=\"start\" "
         "draw:auto-grow-height=\"false\" />"
-     << std::endl
-     << "</style:style>" << std::endl;
+     << '\n'
+     << "</style:style>" << '\n';
 
   // Generic signal
-  os << "<!-- Generic box -->" << std::endl
+  os << "<!-- Generic box -->" << '\n'
      << "<style:style style:name=\"genericSignal\" style:family=\"graphic\" "
         "style:parent-style-name=\"standard\">"
-     << std::endl
+     << '\n'
      << "<style:graphic-properties svg:stroke-width=\""
-     << cfg.getString("genericSignal.strokeWidth") << "\" draw:stroke=\""
-     << cfg.getString("genericSignal.stroke") << "\" svg:stroke-color=\""
-     << cfg.getString("genericSignal.strokeColor") << "\" draw:fill=\""
-     << cfg.getString("genericSignal.fill") << "\" draw:fill-color=\""
-     << cfg.getString("genericSignal.fillColor")
+     << mSettings.genericSignalShape.strokeWidth << "\" draw:stroke=\""
+     << mSettings.genericSignalShape.stroke << "\" svg:stroke-color=\""
+     << mSettings.genericSignalShape.strokeColor << "\" draw:fill=\""
+     << mSettings.genericSignalShape.fill << "\" draw:fill-color=\""
+     << mSettings.genericSignalShape.fillColor
      << "\" draw:textarea-horizontal-align=\"justify\" "
         "draw:textarea-vertical-align=\"middle\" "
         "draw:auto-grow-height=\"false\" />"
-     << std::endl
-     << "</style:style>" << std::endl;
+     << '\n'
+     << "</style:style>" << '\n';
 
   // Text styles
   // Label
-  os << "<!-- Text styles -->" << std::endl
-     << "<!-- label -->" << std::endl
+  os << "<!-- Text styles -->" << '\n'
+     << "<!-- label -->" << '\n'
      << "<style:style style:name=\"tlabel\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"center\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"center\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("label.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("label.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("label.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("label.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("label.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.labelFont.family << "\" fo:font-size=\""
+     << mSettings.labelFont.size << "\" style:font-size-asian=\""
+     << mSettings.labelFont.size << "\" style:font-size-complex=\""
+     << mSettings.labelFont.size << "\" fo:font-weight=\""
+     << mSettings.labelFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Entity
-  os << "<!-- Entity -->" << std::endl
+  os << "<!-- Entity -->" << '\n'
      << "<style:style style:name=\"tentity\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"center\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"center\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("entity.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("entity.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("entity.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("entity.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("entity.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.entityFont.family << "\" fo:font-size=\""
+     << mSettings.entityFont.size << "\" style:font-size-asian=\""
+     << mSettings.entityFont.size << "\" style:font-size-complex=\""
+     << mSettings.entityFont.size << "\" fo:font-weight=\""
+     << mSettings.entityFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Left side port
-  os << "<!-- Left side port -->" << std::endl
+  os << "<!-- Left side port -->" << '\n'
      << "<style:style style:name=\"tlsport\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"start\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"start\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("port.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("port.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("port.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("port.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("port.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.portFont.family << "\" fo:font-size=\""
+     << mSettings.portFont.size << "\" style:font-size-asian=\""
+     << mSettings.portFont.size << "\" style:font-size-complex=\""
+     << mSettings.portFont.size << "\" fo:font-weight=\""
+     << mSettings.portFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Right side port
-  os << "<!-- Right side port -->" << std::endl
+  os << "<!-- Right side port -->" << '\n'
      << "<style:style style:name=\"trsport\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"end\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"end\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("port.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("port.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("port.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("port.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("port.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.portFont.family << "\" fo:font-size=\""
+     << mSettings.portFont.size << "\" style:font-size-asian=\""
+     << mSettings.portFont.size << "\" style:font-size-complex=\""
+     << mSettings.portFont.size << "\" fo:font-weight=\""
+     << mSettings.portFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Center port
-  os << "<!-- Center port -->" << std::endl
+  os << "<!-- Center port -->" << '\n'
      << "<style:style style:name=\"tcport\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"center\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"center\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("port.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("port.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("port.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("port.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("port.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.portFont.family << "\" fo:font-size=\""
+     << mSettings.portFont.size << "\" style:font-size-asian=\""
+     << mSettings.portFont.size << "\" style:font-size-complex=\""
+     << mSettings.portFont.size << "\" fo:font-weight=\""
+     << mSettings.portFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Vector length centered
   os
-    << "<!-- Vector length left side -->" << std::endl
+    << "<!-- Vector length left side -->" << '\n'
     << "<style:style style:name=\"vector_centered\" style:family=\"paragraph\">"
-    << std::endl
-    << "<style:paragraph-properties fo:text-align=\"center\"/>" << std::endl
+    << '\n'
+    << "<style:paragraph-properties fo:text-align=\"center\"/>" << '\n'
     << "<style:text-properties fo:font-family=\""
-    << cfg.getString("vector.fontFamily") << "\" fo:font-size=\""
-    << cfg.getString("vector.fontSize") << "\" style:font-size-asian=\""
-    << cfg.getString("vector.fontSize") << "\" style:font-size-complex=\""
-    << cfg.getString("vector.fontSize") << "\" fo:font-weight=\""
-    << cfg.getString("vector.fontWeight") << "\"/>" << std::endl
-    << "</style:style>" << std::endl;
+    << mSettings.vectorFont.family << "\" fo:font-size=\""
+    << mSettings.vectorFont.size << "\" style:font-size-asian=\""
+    << mSettings.vectorFont.size << "\" style:font-size-complex=\""
+    << mSettings.vectorFont.size << "\" fo:font-weight=\""
+    << mSettings.vectorFont.weight << "\"/>" << '\n'
+    << "</style:style>" << '\n';
 
   // Vector length left side
-  os << "<!-- Vector length left side -->" << std::endl
+  os << "<!-- Vector length left side -->" << '\n'
      << "<style:style style:name=\"vectorls\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"end\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"end\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("vector.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("vector.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("vector.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("vector.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("vector.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.vectorFont.family << "\" fo:font-size=\""
+     << mSettings.vectorFont.size << "\" style:font-size-asian=\""
+     << mSettings.vectorFont.size << "\" style:font-size-complex=\""
+     << mSettings.vectorFont.size << "\" fo:font-weight=\""
+     << mSettings.vectorFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Vector length right side
-  os << "<!-- Vector length right side -->" << std::endl
+  os << "<!-- Vector length right side -->" << '\n'
      << "<style:style style:name=\"vectorrs\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"start\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"start\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("vector.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("vector.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("vector.fontSize") << "\" style:font-size-complex=\""
-     << cfg.getString("vector.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("vector.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.vectorFont.family << "\" fo:font-size=\""
+     << mSettings.vectorFont.size << "\" style:font-size-asian=\""
+     << mSettings.vectorFont.size << "\" style:font-size-complex=\""
+     << mSettings.vectorFont.size << "\" fo:font-weight=\""
+     << mSettings.vectorFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
   // Generics
-  os << "<!-- generics length right side -->" << std::endl
+  os << "<!-- generics length right side -->" << '\n'
      << "<style:style style:name=\"generics\" style:family=\"paragraph\">"
-     << std::endl
-     << "<style:paragraph-properties fo:text-align=\"start\"/>" << std::endl
+     << '\n'
+     << "<style:paragraph-properties fo:text-align=\"start\"/>" << '\n'
      << "<style:text-properties fo:font-family=\""
-     << cfg.getString("genericSignal.fontFamily") << "\" fo:font-size=\""
-     << cfg.getString("genericSignal.fontSize") << "\" style:font-size-asian=\""
-     << cfg.getString("genericSignal.fontSize")
+     << mSettings.genericSignalFont.family << "\" fo:font-size=\""
+     << mSettings.genericSignalFont.size << "\" style:font-size-asian=\""
+     << mSettings.genericSignalFont.size
      << "\" style:font-size-complex=\""
-     << cfg.getString("genericSignal.fontSize") << "\" fo:font-weight=\""
-     << cfg.getString("genericSignal.fontWeight") << "\"/>" << std::endl
-     << "</style:style>" << std::endl;
+     << mSettings.genericSignalFont.size << "\" fo:font-weight=\""
+     << mSettings.genericSignalFont.weight << "\"/>" << '\n'
+     << "</style:style>" << '\n';
 
-  os << "</office:automatic-styles>" << std::endl;
+  os << "</office:automatic-styles>" << '\n';
 
   return;
 }
@@ -517,25 +518,25 @@ void
 FODGWriter::FODGPage(double width, double height)
 {
   // Default declarations
-  os << " <office:automatic-styles>" << std::endl
-     << "  <!-- page layout -->" << std::endl
-     << "  <style:page-layout style:name=\"PM0\">" << std::endl
+  os << " <office:automatic-styles>" << '\n'
+     << "  <!-- page layout -->" << '\n'
+     << "  <style:page-layout style:name=\"PM0\">" << '\n'
      << "   <style:page-layout-properties fo:margin-top=\"0cm\" "
         "fo:margin-bottom=\"0cm\" fo:margin-left=\"0cm\" "
         "fo:margin-right=\"0cm\" fo:page-width=\""
      << width << "cm\" fo:page-height=\"" << height
-     << "cm\" style:print-orientation=\"portrait\"/>" << std::endl
-     << "  </style:page-layout>" << std::endl
-     << "  <!-- page style ?? -->" << std::endl
+     << "cm\" style:print-orientation=\"portrait\"/>" << '\n'
+     << "  </style:page-layout>" << '\n'
+     << "  <!-- page style ?? -->" << '\n'
      << "  <style:style style:name=\"dp1\" style:family=\"drawing-page\">"
-     << std::endl
+     << '\n'
      << "   <style:drawing-page-properties draw:background-size=\"border\" "
         "draw:fill=\"none\"/>"
-     << std::endl
-     << "  </style:style>" << std::endl
-     << "  <!-- page style ?? -->" << std::endl
+     << '\n'
+     << "  </style:style>" << '\n'
+     << "  <!-- page style ?? -->" << '\n'
      << "  <style:style style:name=\"dp2\" style:family=\"drawing-page\"/>"
-     << std::endl;
+     << '\n';
 
   return;
 }
@@ -547,11 +548,11 @@ FODGWriter::circle(double x, double y, double diameter, std::string shapeID)
      << "\" draw:layer = \"layout\" svg:width=\"" << diameter
      << "cm\" svg:height=\"" << diameter << "cm\" svg:x=\""
      << x - (diameter / 2) << "cm\" svg:y=\"" << y - (diameter / 2) << "cm\">"
-     << std::endl
+     << '\n'
      << "\t\t<draw:enhanced-geometry draw:type=\"ellipse\" "
         "draw:enhanced-path=\"U 10800 10800 10800 10800 0 360 Z N\"/>"
-     << std::endl
-     << "\t</draw:custom-shape>" << std::endl;
+     << '\n'
+     << "\t</draw:custom-shape>" << '\n';
 
   return;
 }
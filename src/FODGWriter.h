@@ -31,6 +31,8 @@
 #ifndef SVGWRITER_H
 #define SVGWRITER_H
 
+#include "Config.h"
+
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -92,6 +94,9 @@ public:
 
 private:
   std::ostream& os;
+
+  // Typed config values for styles
+  const ConfigSnapshot& mSettings;
   int gluePointID;
   void header();
 };
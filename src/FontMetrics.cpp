@@ -0,0 +1,130 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: FontMetrics.cpp
+*	Author: Benjamin Wießneth
+*	Description: Glyph advance widths of the fonts used in the drawings
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "FontMetrics.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+// Number of printable ASCII characters from ' ' to '~'
+static const int PRINTABLE = 95;
+
+// Expands the widths of the printable ASCII characters to all byte values.
+// Other characters get the width of 'n', which is close to the average
+static constexpr FontMetrics::Advances
+expand(const unsigned short (&printable)[PRINTABLE])
+{
+  FontMetrics::Advances advances = {};
+  unsigned short fallback = printable['n' - ' '];
+  for (int c = 0; c < 256; c++)
+    advances[c] = (c >= ' ' && c <= '~') ? printable[c - ' '] : fallback;
+  return advances;
+}
+
+// Advance widths in 1/1000 em of the standard PostScript fonts. Arial,
+// Liberation Sans and Nimbus Sans share the Helvetica metrics, Times New Roman
+// those of Times and Courier New those of Courier
+static constexpr unsigned short helvetica[PRINTABLE] = {
+  278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278,
+  278, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584,
+  584, 556, 1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556,
+  833, 722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278,
+  278, 278, 469, 556, 333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222,
+  500, 222, 833, 556, 556, 556, 556, 333, 500, 278, 556, 500, 722, 500, 500,
+  500, 334, 260, 334, 584
+};
+
+static constexpr unsigned short helveticaBold[PRINTABLE] = {
+  278, 333, 474, 556, 556, 889, 722, 238, 333, 333, 389, 584, 278, 333, 278,
+  278, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 333, 333, 584, 584,
+  584, 611, 975, 722, 722, 722, 722, 667, 611, 778, 722, 278, 556, 722, 611,
+  833, 722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 333,
+  278, 333, 584, 556, 333, 556, 611, 556, 611, 556, 333, 611, 611, 278, 278,
+  556, 278, 889, 611, 611, 611, 611, 389, 556, 333, 611, 556, 778, 556, 556,
+  500, 389, 280, 389, 584
+};
+
+static constexpr unsigned short times[PRINTABLE] = {
+  250, 333, 408, 500, 500, 833, 778, 180, 333, 333, 500, 564, 250, 333, 250,
+  278, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 278, 278, 564, 564,
+  564, 444, 921, 722, 667, 667, 722, 611, 556, 722, 722, 333, 389, 722, 611,
+  889, 722, 722, 556, 722, 667, 556, 611, 722, 722, 944, 722, 722, 611, 333,
+  278, 333, 469, 500, 333, 444, 500, 444, 500, 444, 333, 500, 500, 278, 278,
+  500, 278, 778, 500, 500, 500, 500, 333, 389, 278, 500, 500, 722, 500, 500,
+  444, 480, 200, 480, 541
+};
+
+static constexpr unsigned short timesBold[PRINTABLE] = {
+  250, 333, 555, 500, 500, 1000, 833, 278, 333, 333, 500, 570, 250, 333, 250,
+  278, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 333, 333, 570, 570,
+  570, 500, 930, 722, 667, 722, 722, 667, 611, 778, 778, 389, 500, 778, 667,
+  944, 722, 778, 611, 778, 722, 556, 667, 722, 722, 1000, 722, 722, 667, 333,
+  278, 333, 581, 500, 333, 500, 556, 444, 556, 444, 333, 500, 556, 278, 333,
+  556, 278, 833, 556, 500, 556, 556, 444, 389, 333, 556, 500, 722, 500, 500,
+  444, 394, 220, 394, 520
+};
+
+static constexpr FontMetrics sansSerif(expand(helvetica));
+static constexpr FontMetrics sansSerifBold(expand(helveticaBold));
+static constexpr FontMetrics serif(expand(times));
+static constexpr FontMetrics serifBold(expand(timesBold));
+
+// All glyphs of Courier are 600 units wide, regardless of the weight
+static constexpr FontMetrics monospace([] {
+  FontMetrics::Advances advances = {};
+  for (unsigned short& advance : advances)
+    advance = 600;
+  return advances;
+}());
+
+const FontMetrics&
+FontMetrics::get(const std::string& family, const std::string& weight)
+{
+  std::string name = family;
+  std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+    return std::tolower(c);
+  });
+
+  // Same rule as used by the PNG rasterizer
+  bool bold = (weight == "bold" || weight == "bolder" ||
+               std::atoi(weight.c_str()) >= 600);
+
+  if (name.find("courier") != std::string::npos ||
+      name.find("mono") != std::string::npos)
+    return monospace;
+
+  if (name.find("times") != std::string::npos ||
+      (name.find("serif") != std::string::npos &&
+       name.find("sans") == std::string::npos))
+    return bold ? serifBold : serif;
+
+  return bold ? sansSerifBold : sansSerif;
+}
@@ -0,0 +1,79 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: FontMetrics.h
+*	Author: Benjamin Wießneth
+*	Description: Glyph advance widths of the fonts used in the drawings
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef FONTMETRICS_H
+#define FONTMETRICS_H
+
+#include <array>
+#include <string>
+#include <string_view>
+
+// Advance widths of a font for all byte values. The tables are built at
+// compile time, so measuring text neither allocates nor looks up the font
+class FontMetrics
+{
+public:
+  static const int unitsPerEm = 1000;
+
+  typedef std::array<unsigned short, 256> Advances;
+
+  constexpr FontMetrics(const Advances& advances)
+    : mAdvances(advances)
+  {}
+
+  // Returns the metrics of the given font family and weight. Sans-serif
+  // metrics (Arial/Helvetica) are used for unknown families
+  static const FontMetrics& get(const std::string& family,
+                                const std::string& weight);
+
+  // Returns the width of text in em
+  double getTextWidth(std::string_view text) const
+  {
+    // Four independent sums, so the additions don't wait for each other
+    unsigned long sum[4] = { 0, 0, 0, 0 };
+    const unsigned char* c = (const unsigned char*)text.data();
+    size_t i = 0;
+    for (; i + 4 <= text.size(); i += 4) {
+      sum[0] += mAdvances[c[i]];
+      sum[1] += mAdvances[c[i + 1]];
+      sum[2] += mAdvances[c[i + 2]];
+      sum[3] += mAdvances[c[i + 3]];
+    }
+    for (; i < text.size(); i++)
+      sum[0] += mAdvances[c[i]];
+
+    return (double)(sum[0] + sum[1] + sum[2] + sum[3]) / unitsPerEm;
+  }
+
+private:
+  Advances mAdvances;
+};
+
+#endif
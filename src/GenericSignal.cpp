@@ -61,51 +61,51 @@ GenericSignal::GenericSignal(string gL,
     isVector = false;
 }
 
-string
-GenericSignal::getGenericName()
+const std::string&
+GenericSignal::getGenericName() const
 {
   return genericName;
 }
 
-string
-GenericSignal::getGenericTypeStr()
+const std::string&
+GenericSignal::getGenericTypeStr() const
 {
   return genericTypeStr;
 }
 
 bool
-GenericSignal::getIsVector()
+GenericSignal::getIsVector() const
 {
   return isVector;
 }
 
 // Returns vector length
 int
-GenericSignal::getVectorLength()
+GenericSignal::getVectorLength() const
 {
   return vectorLength;
 }
 
 int
-GenericSignal::getVectorStart()
+GenericSignal::getVectorStart() const
 {
   return vectorStart;
 }
 
 int
-GenericSignal::getVectorEnd()
+GenericSignal::getVectorEnd() const
 {
   return vectorEnd;
 }
 
-string
-GenericSignal::getDefaultValue()
+const std::string&
+GenericSignal::getDefaultValue() const
 {
   return defaultValue;
 }
 
 string
-GenericSignal::getGenericStr()
+GenericSignal::getGenericStr() const
 {
   // Add the generics name to return string
   string tmp = genericName;
@@ -48,21 +48,21 @@ public:
                 std::string vectorStart = "",
                 std::string vectorEnd = "");
   // Returns stored generic name
-  string getGenericName();
+  const std::string& getGenericName() const;
   // Returns stored generic type
-  string getGenericTypeStr();
+  const std::string& getGenericTypeStr() const;
   // Returns if generic signal is a vector type
-  bool getIsVector();
+  bool getIsVector() const;
   // Returns vector length
-  int getVectorLength();
+  int getVectorLength() const;
   // Returns vector start value
-  int getVectorStart();
+  int getVectorStart() const;
   // Returns vector end value
-  int getVectorEnd();
+  int getVectorEnd() const;
   // Returns signal default value
-  string getDefaultValue();
+  const std::string& getDefaultValue() const;
   // Returns a string with all information about signal
-  string getGenericStr();
+  string getGenericStr() const;
 
 private:
   string genericName;    // name
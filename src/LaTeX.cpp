@@ -32,14 +32,11 @@
 #include "Config.h"
 #include "MSG.h"
 
-LaTeX::LaTeX(VHDLEntity sourceEntity)
-  : OFileHandler(sourceEntity, "LaTeX", "tex")
+LaTeX::LaTeX(const VHDLEntity& sourceEntity, std::ostream& os)
+  : OFileHandler(sourceEntity, os)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "LaTeX::LaTeX(VHDLEntity sourceEntity)";
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mConfigName = " << mConfigName;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mExtension = " << mExtension;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mSuffix = " << mSuffix;
+    << "LaTeX::LaTeX(const VHDLEntity& sourceEntity)";
 
   getMaxTextLengths();
 
@@ -53,9 +50,9 @@ LaTeX::Polarity(int i)
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "LaTeX::Polarity(int i)";
 
   if (mSourceEntity.getLOWActive(i) == true) {
-    return cfg.getString("Table.caption_LOWactive");
+    return mSettings.table.captionLOWactive;
   } else {
-    return cfg.getString("Table.caption_HIGHactive");
+    return mSettings.table.captionHIGHactive;
   }
 }
 
@@ -81,35 +78,36 @@ LaTeX::Type(int i)
 void
 LaTeX::getTable()
 {
-  if (cfg.getBool("LaTeX.addTable")) {
-    mOutputFile << "\\begin{table}[htbp]" << std::endl;
+  if (mSettings.latex.addTable) {
+    mOutput << "\\begin{table}[htbp]" << '\n';
 
-    if (cfg.getBool("LaTeX.centering"))
-      mOutputFile << "\\centering" << std::endl;
+    if (mSettings.latex.centering)
+      mOutput << "\\centering" << '\n';
 
-    if (cfg.getBool("LaTeX.caption"))
-      mOutputFile << "\\caption{"
+    if (mSettings.latex.caption)
+      mOutput << "\\caption{"
                   << replaceStr(mSourceEntity.getEntityName(), "_", "\\_")
-                  << "}" << std::endl;
+                  << "}" << '\n';
 
-    if (cfg.getBool("LaTeX.label"))
-      mOutputFile << "\\label{ref:" << mSourceEntity.getEntityName() << "}"
-                  << std::endl;
+    if (mSettings.latex.label)
+      mOutput << "\\label{ref:" << mSourceEntity.getEntityName() << "}"
+                  << '\n';
   }
 
   getHeaderPorts();
   getPorts();
 
-  if (cfg.getBool("Table.exportGenerics") && mSourceEntity.getNumberOfGenerics() > 0) {
-    if (cfg.getBool("LaTeX.addTable"))
-      mOutputFile << "\\vspace*{ 1 em }" << std::endl << std::endl;
+  if (mSettings.table.exportGenerics &&
+      mSourceEntity.getNumberOfGenerics() > 0) {
+    if (mSettings.latex.addTable)
+      mOutput << "\\vspace*{ 1 em }" << '\n' << '\n';
 
     getHeaderGenerics();
     getGenerics();
   }
 
-  if (cfg.getBool("LaTeX.addTable")) {
-    mOutputFile << "\\end{table}" << std::endl;
+  if (mSettings.latex.addTable) {
+    mOutput << "\\end{table}" << '\n';
   }
 }
 
@@ -123,13 +121,13 @@ LaTeX::getGenerics()
   for (int i = 0; i < mSourceEntity.getNumberOfGenerics(); i++) {
     writeCell(
       colNames::GenericName, mSourceEntity.getGenericName(i), " ", " ", " ");
-    mOutputFile << "&";
+    mOutput << "&";
 
     std::string tmpStr = mSourceEntity.getGenericType(i);
 
-    if (cfg.getBool("Table.showArrayLength") &&
+    if (mSettings.table.showArrayLength &&
         mSourceEntity.getGenericIsVector(i)) {
-      if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.arrayNotation)
         tmpStr +=
           "[" + std::to_string(mSourceEntity.getGenericVectorLength(i)) + "]";
       else
@@ -139,18 +137,18 @@ LaTeX::getGenerics()
     }
     writeCell(colNames::GenericType, tmpStr, " ", " ", " ");
 
-    mOutputFile << "&";
+    mOutput << "&";
     writeCell(colNames::DefaultValue,
               mSourceEntity.getGenericDefaultValue(i),
               " ",
               " ",
               " ");
-    mOutputFile << "\\\\";
+    mOutput << "\\\\";
 
-    mOutputFile << std::endl;
+    mOutput << '\n';
   }
 
-  mOutputFile << "\\hline" << std::endl << "\\end{tabular}" << std::endl;
+  mOutput << "\\hline" << '\n' << "\\end{tabular}" << '\n';
 }
 
 // Generate the table header for the generic signals
@@ -159,64 +157,64 @@ LaTeX::getHeaderGenerics()
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "LaTeX::getHeaderGenerics()";
 
-  mOutputFile << "\\begin{tabular}{ ";
+  mOutput << "\\begin{tabular}{ ";
 
-  if (cfg.getBool("Table.centeredGenericName"))
-    mOutputFile << "c ";
+  if (mSettings.table.centeredGenericName)
+    mOutput << "c ";
   else
-    mOutputFile << "l ";
+    mOutput << "l ";
 
-  if (cfg.getBool("Table.centeredGenericType"))
-    mOutputFile << "c ";
+  if (mSettings.table.centeredGenericType)
+    mOutput << "c ";
   else
-    mOutputFile << "l ";
+    mOutput << "l ";
 
-  if (cfg.getBool("Table.centeredGenericDefaultValue"))
-    mOutputFile << "c ";
+  if (mSettings.table.centeredGenericDefaultValue)
+    mOutput << "c ";
   else
-    mOutputFile << "l ";
+    mOutput << "l ";
 
-  mOutputFile << "}" << std::endl;
-  mOutputFile << "\\hline" << std::endl;
+  mOutput << "}" << '\n';
+  mOutput << "\\hline" << '\n';
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     writeCell(colNames::Name,
-              cfg.getString("Table.GenericName"),
+              mSettings.table.genericName,
               "\\textbf{",
               "} ",
               " ");
   else
-    writeCell(colNames::Name, cfg.getString("Table.GenericName"), "", "", " ");
+    writeCell(colNames::Name, mSettings.table.genericName, "", "", " ");
 
-  mOutputFile << "&";
+  mOutput << "&";
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     writeCell(colNames::Type,
-              cfg.getString("Table.GenericType"),
+              mSettings.table.genericType,
               " \\textbf{",
               "} ",
               " ");
   else
     writeCell(
-      colNames::Type, cfg.getString("Table.GenericType"), " ", " ", " ");
+      colNames::Type, mSettings.table.genericType, " ", " ", " ");
 
-  mOutputFile << "&";
+  mOutput << "&";
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     writeCell(colNames::DefaultValue,
-              cfg.getString("Table.GenericDefaultValue"),
+              mSettings.table.genericDefaultValue,
               " \\textbf{",
               "} ",
               " ");
   else
     writeCell(colNames::DefaultValue,
-              cfg.getString("Table.GenericDefaultValue"),
+              mSettings.table.genericDefaultValue,
               " ",
               " ",
               " ");
 
-  mOutputFile << "\\\\" << std::endl;
-  mOutputFile << "\\hline" << std::endl;
+  mOutput << "\\\\" << '\n';
+  mOutput << "\\hline" << '\n';
 }
 
 // Generate the table header for the IO ports
@@ -225,162 +223,162 @@ LaTeX::getHeaderPorts()
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "LaTeX::getHeaderPorts()";
 
-  mOutputFile << "\\begin{tabular}{ ";
+  mOutput << "\\begin{tabular}{ ";
 
-  if (cfg.getBool("Table.centeredName"))
-    mOutputFile << "c ";
+  if (mSettings.table.centeredName)
+    mOutput << "c ";
   else
-    mOutputFile << "l ";
+    mOutput << "l ";
 
-  if (cfg.getBool("Table.exportType")) {
-    if (cfg.getBool("Table.centeredType"))
-      mOutputFile << "c ";
+  if (mSettings.table.exportType) {
+    if (mSettings.table.centeredType)
+      mOutput << "c ";
     else
-      mOutputFile << "l ";
+      mOutput << "l ";
   }
 
-  if (cfg.getBool("Table.exportDirection")) {
-    if (cfg.getBool("Table.centeredDirection"))
-      mOutputFile << "c ";
+  if (mSettings.table.exportDirection) {
+    if (mSettings.table.centeredDirection)
+      mOutput << "c ";
     else
-      mOutputFile << "l ";
+      mOutput << "l ";
   }
 
-  if (cfg.getBool("Table.exportPolarity")) {
-    if (cfg.getBool("Table.centeredPolarity"))
-      mOutputFile << "c ";
+  if (mSettings.table.exportPolarity) {
+    if (mSettings.table.centeredPolarity)
+      mOutput << "c ";
     else
-      mOutputFile << "l ";
+      mOutput << "l ";
   }
 
-  if (cfg.getBool("Table.exportDescription")) {
-    if (cfg.getBool("Table.centeredDescription"))
-      mOutputFile << "c ";
+  if (mSettings.table.exportDescription) {
+    if (mSettings.table.centeredDescription)
+      mOutput << "c ";
     else
-      mOutputFile << "l ";
+      mOutput << "l ";
   }
 
-  if (cfg.getBool("Table.exportBlank1")) {
-    if (cfg.getBool("Table.centeredBlank"))
-      mOutputFile << "c ";
+  if (mSettings.table.exportBlank1) {
+    if (mSettings.table.centeredBlank)
+      mOutput << "c ";
     else
-      mOutputFile << "l ";
+      mOutput << "l ";
   }
 
-  if (cfg.getBool("Table.exportBlank2")) {
-    if (cfg.getBool("Table.centeredBlank"))
-      mOutputFile << "c ";
+  if (mSettings.table.exportBlank2) {
+    if (mSettings.table.centeredBlank)
+      mOutput << "c ";
     else
-      mOutputFile << "l ";
+      mOutput << "l ";
   }
 
-  mOutputFile << "}" << std::endl;
-  mOutputFile << "\\hline" << std::endl;
+  mOutput << "}" << '\n';
+  mOutput << "\\hline" << '\n';
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     writeCell(colNames::Name,
-              cfg.getString("Table.Name_heading"),
+              mSettings.table.nameHeading,
               "\\textbf{",
               "} ",
               " ");
   else
-    writeCell(colNames::Name, cfg.getString("Table.Name_heading"), "", "", " ");
+    writeCell(colNames::Name, mSettings.table.nameHeading, "", "", " ");
 
-  if ((cfg.getBool("Table.exportType")) &&
-      !cfg.getBool("Table.combineNameAndType")) {
-    mOutputFile << "&";
+  if ((mSettings.table.exportType) &&
+      !mSettings.table.combineNameAndType) {
+    mOutput << "&";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Type,
-                cfg.getString("Table.Type_heading"),
+                mSettings.table.typeHeading,
                 " \\textbf{",
                 "} ",
                 " ");
     else
       writeCell(
-        colNames::Type, cfg.getString("Table.Type_heading"), " ", " ", " ");
+        colNames::Type, mSettings.table.typeHeading, " ", " ", " ");
   }
 
-  if (cfg.getBool("Table.exportDirection")) {
-    mOutputFile << "&";
+  if (mSettings.table.exportDirection) {
+    mOutput << "&";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Direction,
-                cfg.getString("Table.Direction_heading"),
+                mSettings.table.directionHeading,
                 " \\textbf{",
                 "} ",
                 " ");
     else
       writeCell(colNames::Direction,
-                cfg.getString("Table.Direction_heading"),
+                mSettings.table.directionHeading,
                 " ",
                 " ",
                 " ");
   }
 
-  if (cfg.getBool("Table.exportPolarity")) {
-    mOutputFile << "&";
+  if (mSettings.table.exportPolarity) {
+    mOutput << "&";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Polarity,
-                cfg.getString("Table.Polarity_heading"),
+                mSettings.table.polarityHeading,
                 " \\textbf{",
                 "} ",
                 " ");
     else
       writeCell(colNames::Polarity,
-                cfg.getString("Table.Polarity_heading"),
+                mSettings.table.polarityHeading,
                 " ",
                 " ",
                 " ");
   }
 
-  if (cfg.getBool("Table.exportDescription")) {
-    mOutputFile << "&";
+  if (mSettings.table.exportDescription) {
+    mOutput << "&";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Description,
-                cfg.getString("Table.Description_heading"),
+                mSettings.table.descriptionHeading,
                 " \\textbf{",
                 "} ",
                 " ");
     else
       writeCell(colNames::Description,
-                cfg.getString("Table.Description_heading"),
+                mSettings.table.descriptionHeading,
                 " ",
                 " ",
                 " ");
   }
 
-  if (cfg.getBool("Table.exportBlank1")) {
-    mOutputFile << "&";
+  if (mSettings.table.exportBlank1) {
+    mOutput << "&";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Blank,
-                cfg.getString("Table.Blank1_heading"),
+                mSettings.table.blank1Heading,
                 " \\textbf{",
                 "} ",
                 " ");
     else
       writeCell(
-        colNames::Blank, cfg.getString("Table.Blank1_heading"), " ", " ", " ");
+        colNames::Blank, mSettings.table.blank1Heading, " ", " ", " ");
   }
 
-  if (cfg.getBool("Table.exportBlank2")) {
-    mOutputFile << "&";
+  if (mSettings.table.exportBlank2) {
+    mOutput << "&";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Blank,
-                cfg.getString("Table.Blank2_heading"),
+                mSettings.table.blank2Heading,
                 " \\textbf{",
                 "} ",
                 " ");
     else
       writeCell(
-        colNames::Blank, cfg.getString("Table.Blank2_heading"), " ", " ", " ");
+        colNames::Blank, mSettings.table.blank2Heading, " ", " ", " ");
   }
-  mOutputFile << "\\\\" << std::endl;
-  mOutputFile << "\\hline" << std::endl;
+  mOutput << "\\\\" << '\n';
+  mOutput << "\\hline" << '\n';
 }
 
 // Generate table for the IO ports
@@ -398,9 +396,9 @@ LaTeX::getPorts()
     // Create rows
     std::string tmpStr = mSourceEntity.getPortName(i);
 
-    if (cfg.getBool("Table.showArrayLength") && mSourceEntity.isVector(i) &&
-        cfg.getBool("Table.combineNameAndType")) {
-      if (cfg.getBool("Table.arrayNotation"))
+    if (mSettings.table.showArrayLength && mSourceEntity.isVector(i) &&
+        mSettings.table.combineNameAndType) {
+      if (mSettings.table.arrayNotation)
         tmpStr += "[" + mSourceEntity.getVectorStr(i) + "]";
       else
         tmpStr += "[" + mSourceEntity.getVectorStartStr(i) + ":" +
@@ -409,14 +407,14 @@ LaTeX::getPorts()
     writeCell(colNames::Name, tmpStr, "", "", " ");
 
     tmpStr.clear();
-    if ((cfg.getBool("Table.exportType")) &&
-        !cfg.getBool("Table.combineNameAndType")) {
-      mOutputFile << "&";
+    if ((mSettings.table.exportType) &&
+        !mSettings.table.combineNameAndType) {
+      mOutput << "&";
 
       tmpStr += Type(i);
-      if (cfg.getBool("Table.showArrayLength") && mSourceEntity.isVector(i) &&
-          !cfg.getBool("Table.combineNameAndType")) {
-        if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.showArrayLength && mSourceEntity.isVector(i) &&
+          !mSettings.table.combineNameAndType) {
+        if (mSettings.table.arrayNotation)
           tmpStr += "[" + mSourceEntity.getVectorStr(i) + "]";
         else
           tmpStr += "[" + mSourceEntity.getVectorStartStr(i) + ":" +
@@ -425,35 +423,35 @@ LaTeX::getPorts()
       writeCell(colNames::Type, tmpStr, " ", " ", " ");
     }
 
-    if (cfg.getBool("Table.exportDirection")) {
-      mOutputFile << "&";
+    if (mSettings.table.exportDirection) {
+      mOutput << "&";
       writeCell(colNames::Direction, Direction(i), " ", " ", " ");
     }
 
-    if (cfg.getBool("Table.exportPolarity")) {
-      mOutputFile << "&";
+    if (mSettings.table.exportPolarity) {
+      mOutput << "&";
       writeCell(colNames::Polarity, Polarity(i), " ", " ", " ");
     }
 
-    if (cfg.getBool("Table.exportDescription")) {
-      mOutputFile << "&";
+    if (mSettings.table.exportDescription) {
+      mOutput << "&";
       writeCell(colNames::Description, "", "", "", " ");
     }
 
-    if (cfg.getBool("Table.exportBlank1")) {
-      mOutputFile << "&";
+    if (mSettings.table.exportBlank1) {
+      mOutput << "&";
       writeCell(colNames::Blank, "", "", "", " ");
     }
 
-    if (cfg.getBool("Table.exportBlank2")) {
-      mOutputFile << "&";
+    if (mSettings.table.exportBlank2) {
+      mOutput << "&";
       writeCell(colNames::Blank, "", "", "", " ");
     }
 
-    mOutputFile << "\\\\" << std::endl;
+    mOutput << "\\\\" << '\n';
   }
 
-  mOutputFile << "\\hline" << std::endl << "\\end{tabular}" << std::endl;
+  mOutput << "\\hline" << '\n' << "\\end{tabular}" << '\n';
 }
 
 // Get the maximum text lengths for each column in order to align the table
@@ -487,9 +485,9 @@ LaTeX::getMaxTextLengths()
           replaceStr(mSourceEntity.getPortTypeStr(i), "_", "\\_").length());
 
     if (mSourceEntity.isVector(i)) {
-      if (cfg.getBool("Table.showArrayLength")) {
-        if (cfg.getBool("Table.combineNameAndType")) {
-          if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.showArrayLength) {
+        if (mSettings.table.combineNameAndType) {
+          if (mSettings.table.arrayNotation)
             colWidthName = max(
               colWidthName,
               replaceStr(mSourceEntity.getPortName(i), "_", "\\_").length() +
@@ -500,8 +498,8 @@ LaTeX::getMaxTextLengths()
               replaceStr(mSourceEntity.getPortName(i), "_", "\\_").length() +
                 mSourceEntity.getVectorStartStr(i).length() +
                 mSourceEntity.getVectorEndStr(i).length() + 3);
-        } else if (cfg.getBool("Table.exportType")) {
-          if (cfg.getBool("Table.arrayNotation"))
+        } else if (mSettings.table.exportType) {
+          if (mSettings.table.arrayNotation)
             colWidthType = max(
               colWidthType,
               replaceStr(mSourceEntity.getPortTypeStr(i), "_", "\\_").length() +
@@ -526,36 +524,36 @@ LaTeX::getMaxTextLengths()
       max(colWidthGenericType, mSourceEntity.getGenericType(i).length());
   }
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     formattingCorrection = std::string("\textbf{}").length();
 
   colWidthName =
     max(colWidthName,
-        cfg.getString("Table.Name_heading").length() + formattingCorrection);
+        mSettings.table.nameHeading.length() + formattingCorrection);
   colWidthType =
     max(colWidthType,
-        cfg.getString("Table.Type_heading").length() + formattingCorrection);
+        mSettings.table.typeHeading.length() + formattingCorrection);
   colWidthDirection = max(colWidthDirection,
-                          cfg.getString("Table.Direction_heading").length() +
+                          mSettings.table.directionHeading.length() +
                             formattingCorrection);
   colWidthPolarity = max(colWidthPolarity,
-                         cfg.getString("Table.Polarity_heading").length() +
+                         mSettings.table.polarityHeading.length() +
                            formattingCorrection);
   colWidthDescription = max(
     colWidthDescription,
-    cfg.getString("Table.Description_heading").length() + formattingCorrection);
+    mSettings.table.descriptionHeading.length() + formattingCorrection);
   colWidthBlank =
     max(colWidthBlank,
-        cfg.getString("Table.Blank1_heading").length() + formattingCorrection);
+        mSettings.table.blank1Heading.length() + formattingCorrection);
   colWidthBlank =
     max(colWidthBlank,
-        cfg.getString("Table.Blank2_heading").length() + formattingCorrection);
+        mSettings.table.blank2Heading.length() + formattingCorrection);
   colWidthGenericName =
     max(colWidthGenericName,
-        cfg.getString("Table.Name_heading").length() + formattingCorrection);
+        mSettings.table.nameHeading.length() + formattingCorrection);
   colWidthGenericType =
     max(colWidthGenericType,
-        cfg.getString("Table.Type_heading").length() + formattingCorrection);
+        mSettings.table.typeHeading.length() + formattingCorrection);
   colWidthDefaultValue =
     max(colWidthDefaultValue,
         std::string("Default value").length() + formattingCorrection);
@@ -632,15 +630,15 @@ LaTeX::writeCell(colNames column,
       break;
   }
 
-  mOutputFile << prefix;
+  mOutput << prefix;
   textLength += prefix.length();
 
   replaceAll(text, "_", "\\_");
-  mOutputFile << text;
+  mOutput << text;
   textLength += text.length();
 
   if (!formatting) {
-    mOutputFile << suffix;
+    mOutput << suffix;
     textLength += suffix.length();
 
     if (textLength < maxTextLength) {
@@ -649,7 +647,7 @@ LaTeX::writeCell(colNames column,
 
       for (size_t i = 0; i < maxTextLength - textLength; i++) {
         MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "fillChar";
-        mOutputFile << fillChar;
+        mOutput << fillChar;
       }
     }
   } else {
@@ -660,11 +658,11 @@ LaTeX::writeCell(colNames column,
       for (size_t i = 0; i < maxTextLength - textLength - suffix.length();
            i++) {
         MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "fillChar";
-        mOutputFile << fillChar;
+        mOutput << fillChar;
       }
     }
 
-    mOutputFile << suffix;
+    mOutput << suffix;
     textLength += suffix.length();
   }
 }
@@ -57,7 +57,8 @@ private:
   std::string Type(int i);      // Get type string of required port
 
 public:
-  LaTeX(VHDLEntity sourceEntity);
+  // Renders sourceEntity into os
+  LaTeX(const VHDLEntity& sourceEntity, std::ostream& os);
 };
 
 #endif
\ No newline at end of file
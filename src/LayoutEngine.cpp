@@ -0,0 +1,193 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: LayoutEngine.cpp
+*	Author: Benjamin Wießneth
+*	Description: Computes the geometry of the entity symbol
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "LayoutEngine.h"
+#include "Config.h"
+#include "MSG.h"
+
+#include <algorithm>
+#include <math.h>
+
+static const double PT_TO_CM = 2.54 / 72;
+
+Layout
+LayoutEngine::compute(const VHDLEntity& entity, bool gridAligned)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "LayoutEngine::compute(" << entity.getEntityName() << ")";
+
+  const ConfigSnapshot& settings = cfg.getSnapshot();
+
+  Layout layout;
+  layout.groupHeight = 0;
+  layout.entityHeight = 0;
+  layout.genericWidth = 0;
+  layout.genericHeight = 0;
+  layout.vectorTextLengthIn = 0;
+  layout.vectorTextLengthOut = 0;
+
+  int noInputs = entity.getNumberOfInputs();
+  int noOutputs = entity.getNumberOfOutputs();
+
+  // Calculate entityHeight depending on total number of ports and the presence
+  // of special ports No clock port and no reset port
+  if ((entity.getClockPort() == -1) && (entity.getResetPort() == -1)) {
+    layout.entityHeight = std::max(noInputs, noOutputs);
+  }
+  // One clock port and no reset port
+  else if ((entity.getClockPort() != -1) && (entity.getResetPort() == -1)) {
+    if (noInputs - 1 >= noOutputs)
+      layout.entityHeight = noInputs;
+    else
+      layout.entityHeight = noOutputs;
+  }
+  // No clock port and one reset port
+  else if ((entity.getClockPort() == -1) && (entity.getResetPort() != -1)) {
+    if (noInputs - 1 >= noOutputs)
+      layout.entityHeight = noInputs;
+    else
+      layout.entityHeight = noOutputs + 1;
+
+    // Reset connector facing downward => +1
+    layout.groupHeight = 1.0;
+  }
+  // One clock port and one reset port
+  else if ((entity.getClockPort() != -1) && (entity.getResetPort() != -1)) {
+    if ((noInputs - 2) >= noOutputs)
+      layout.entityHeight = noInputs;
+    else
+      layout.entityHeight = noOutputs + 1;
+
+    // Reset connector facing downward => +1
+    layout.groupHeight = 1.0;
+  }
+
+  // Add 1cm for entity caption (always present)
+  layout.entityHeight += 1;
+
+  // includes label
+  layout.groupHeight = layout.groupHeight + layout.entityHeight + 1;
+
+  // Calculate the portWidth or use a fixed width
+  if (settings.fixedWidth <= 0) {
+    // Calculate the portWidth depending on the widest port name if no config
+    // value is given
+    layout.portWidth = 0;
+    for (int i = 0; i < noInputs + noOutputs; i++)
+      layout.portWidth =
+        std::max(layout.portWidth,
+                 calcTextWidth(
+                   entity.getPortName(i), settings.portFont, gridAligned));
+
+    layout.entityWidth = calcTextWidth(
+      entity.getEntityName(), settings.entityFont, gridAligned);
+
+    // Set entityWidth and portWidth to required size
+    if (2 * layout.portWidth > layout.entityWidth)
+      // 2*portWidth is greater than the entity name
+      layout.entityWidth = 2 * layout.portWidth;
+    else
+      // Width of entity Name is greater than 2*portWidth
+      layout.portWidth = 0.5 * layout.entityWidth;
+  } else {
+    // Use the given port width property from config file
+    layout.entityWidth = settings.fixedWidth;
+    layout.portWidth = layout.entityWidth / 2;
+  }
+
+  // Calculate height and width of the generic box
+  if (entity.getNumberOfGenerics() > 0) {
+    // Get widest generic
+    for (int i = 0; i < entity.getNumberOfGenerics(); i++)
+      layout.genericWidth = std::max(layout.genericWidth,
+                                     calcTextWidth(entity.getGenericStr(i),
+                                                   settings.genericSignalFont,
+                                                   gridAligned));
+    layout.genericHeight = entity.getNumberOfGenerics() * 0.5;
+  }
+
+  // Get the widest vector length string on the left side
+  for (int i = 0; i < noInputs; i++) {
+    if (entity.isVector(i))
+      layout.vectorTextLengthIn =
+        std::max(layout.vectorTextLengthIn,
+                 calcTextWidth(
+                   entity.getVectorStr(i), settings.vectorFont, gridAligned));
+  }
+  // If no vector length string is longer than the connector line itself it is
+  // set to 1.0
+  if (layout.vectorTextLengthIn < 1.0)
+    layout.vectorTextLengthIn = 1;
+
+  // Get the widest vector length string on the right side
+  for (int i = noInputs; i < noInputs + noOutputs; i++) {
+    if (entity.isVector(i))
+      layout.vectorTextLengthOut =
+        std::max(layout.vectorTextLengthOut,
+                 calcTextWidth(
+                   entity.getVectorStr(i), settings.vectorFont, gridAligned));
+  }
+
+  // If no vector length string is longer than the connector line itself, it is
+  // set to 1.0
+  if (layout.vectorTextLengthOut < 1.0)
+    layout.vectorTextLengthOut = 1.0;
+
+  // Calculate origins of the drawing. These coordinates are used for glue
+  // points Half the group height
+  layout.originY = layout.groupHeight / 2;
+
+  // Two connectors on each side + rectangle width
+  layout.groupWidth = (2 + layout.entityWidth);
+  layout.originX = layout.groupWidth / 2;
+
+  return layout;
+}
+
+double
+LayoutEngine::calcTextWidth(std::string_view text,
+                            const ConfigSnapshot::Font& font,
+                            bool gridAligned)
+{
+  if (text.empty())
+    return 0;
+
+  // Font sizes are given in pt. The text is placed 0.25cm from each side of
+  // its box
+  double width =
+    font.metrics->getTextWidth(text) * font.sizeValue * PT_TO_CM + 0.5;
+  if (gridAligned)
+    width = floor(width) + 0.5;
+
+  if (width < 1.0)
+    return 1.0;
+  else
+    return width;
+}
@@ -0,0 +1,70 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: LayoutEngine.h
+*	Author: Benjamin Wießneth
+*	Description: Computes the geometry of the entity symbol
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef LAYOUTENGINE_H
+#define LAYOUTENGINE_H
+
+#include "Config.h"
+#include "VHDLEntity.h"
+
+#include <string_view>
+
+// Dimensions of the entity symbol in cm. Computed once per entity and shared
+// by all drawing formats
+struct Layout
+{
+  double entityHeight; // Includes the caption
+  double entityWidth;
+  double groupHeight; // Includes the label and the reset connector
+  double groupWidth;  // Includes the connectors on both sides
+  double originX;     // Center of the group, used for glue points
+  double originY;
+  double portWidth;
+  double genericWidth;
+  double genericHeight;
+  double vectorTextLengthIn; // Longest vector length string of the inputs
+  double vectorTextLengthOut;
+};
+
+class LayoutEngine
+{
+public:
+  // Computes the layout of entity from the current config. If gridAligned is
+  // set text widths are rounded to the 0.5cm grid used by the FODG drawing
+  static Layout compute(const VHDLEntity& entity, bool gridAligned);
+
+  // Returns the width of a box holding text in the given font. The width is
+  // summed from the glyph widths of the font
+  static double calcTextWidth(std::string_view text,
+                              const ConfigSnapshot::Font& font,
+                              bool gridAligned);
+};
+
+#endif
@@ -29,56 +29,425 @@
 \***************************************************************************/
 
 #include "MSG.h"
+#include "Stats.h"
 #include "VEC.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <thread>
+#include <vector>
 
 // Setup static members of the MSG class
 LOG_LEVEL MSG::MaxLogLevel = DEFAULT_LOG_LEVEL;
 DEBUG MSG::MaxDebugLevel = DEFAULT_DEBUG_LEVEL;
+thread_local std::ostream* MSG::threadStream = nullptr;
+thread_local std::string MSG::sourceFile;
+bool MSG::jsonOutput = false;
 
-MSG::~MSG()
+// Stream of the JSON messages, the log file or std::cout. They're written
+// right away instead of being queued with the console output
+static std::ostream* jsonStream = nullptr;
+static std::mutex jsonLock;
+
+// Console output. It goes to std::cerr while std::cout only carries the JSON
+// messages
+static std::atomic<std::ostream*> consoleStream{ &std::cout };
+
+namespace {
+
+// Console output of one thread waiting to be written. Only the owning thread
+// pushes and only the writer thread drains, so no lock is needed
+class MessageRing
+{
+public:
+  // Moves message into a free slot and leaves the empty buffer of an already
+  // written message in it. Returns false if the ring is full
+  bool push(std::string& message)
+  {
+    size_t tail = mTail.load(std::memory_order_relaxed);
+    if (tail - mHead.load(std::memory_order_acquire) == CAPACITY)
+      return false;
+    mSlots[tail % CAPACITY].swap(message);
+    message.clear();
+    mTail.store(tail + 1, std::memory_order_seq_cst);
+    return true;
+  }
+
+  // Writes all queued messages to os and returns their number
+  size_t drain(std::ostream& os)
+  {
+    size_t head = mHead.load(std::memory_order_relaxed);
+    size_t tail = mTail.load(std::memory_order_acquire);
+    for (size_t i = head; i != tail; i++) {
+      const std::string& message = mSlots[i % CAPACITY];
+      os.write(message.data(), message.size());
+      mHead.store(i + 1, std::memory_order_release);
+    }
+    return tail - head;
+  }
+
+  bool isEmpty() const
+  {
+    return mHead.load(std::memory_order_acquire) ==
+           mTail.load(std::memory_order_seq_cst);
+  }
+
+  // Set when the owning thread exited
+  std::atomic<bool> closed{ false };
+
+private:
+  static const size_t CAPACITY = 256;
+
+  std::string mSlots[CAPACITY];
+  std::atomic<size_t> mHead{ 0 }; // Next message to write
+  std::atomic<size_t> mTail{ 0 }; // Next free slot
+};
+
+// Writes the rings of all threads to std::cout in the background
+class ConsoleWriter
+{
+public:
+  ConsoleWriter()
+    : mThread(&ConsoleWriter::run, this)
+  {
+  }
+
+  ~ConsoleWriter()
+  {
+    {
+      std::lock_guard<std::mutex> guard(mLock);
+      mStop = true;
+      mWake.notify_one();
+    }
+    mThread.join();
+  }
+
+  std::shared_ptr<MessageRing> addRing()
+  {
+    std::lock_guard<std::mutex> guard(mLock);
+    mRings.push_back(std::make_shared<MessageRing>());
+    return mRings.back();
+  }
+
+  // Queues message, waiting for the writer if the ring is full
+  void submit(MessageRing& ring, std::string& message)
+  {
+    while (!ring.push(message)) {
+      wake();
+      std::this_thread::yield();
+    }
+    if (mSleeping)
+      wake();
+  }
+
+  // Waits until all rings are empty and written
+  void flush()
+  {
+    std::unique_lock<std::mutex> guard(mLock);
+    mWake.notify_one();
+    mDrained.wait(guard, [this] { return isEmpty(); });
+  }
+
+private:
+  void wake()
+  {
+    std::lock_guard<std::mutex> guard(mLock);
+    mWake.notify_one();
+  }
+
+  bool isEmpty() const
+  {
+    for (const auto& ring : mRings)
+      if (!ring->isEmpty())
+        return false;
+    return true;
+  }
+
+  // The lock is only released while waiting, so flush() and addRing() never
+  // see a half written pass
+  void run()
+  {
+    std::unique_lock<std::mutex> guard(mLock);
+    while (true) {
+      size_t written = 0;
+      for (size_t i = 0; i < mRings.size(); i++) {
+        written += mRings[i]->drain(*consoleStream);
+        if (mRings[i]->closed && mRings[i]->isEmpty())
+          mRings.erase(mRings.begin() + i--);
+      }
+      if (written != 0) {
+        consoleStream.load()->flush();
+        continue;
+      }
+
+      mDrained.notify_all();
+      if (mStop)
+        break;
+
+      // A message pushed after the check sees mSleeping and wakes the writer
+      mSleeping = true;
+      mWake.wait_for(guard, std::chrono::milliseconds(100),
+                     [this] { return mStop || !isEmpty(); });
+      mSleeping = false;
+    }
+  }
+
+  std::mutex mLock;
+  std::condition_variable mWake;
+  std::condition_variable mDrained;
+  std::vector<std::shared_ptr<MessageRing>> mRings;
+  std::atomic<bool> mSleeping{ false };
+  bool mStop = false;
+  std::thread mThread;
+};
+
+// Set when the writer shuts down at exit, later output is written directly
+std::atomic<bool> writerStopped{ false };
+
+ConsoleWriter&
+getWriter()
+{
+  static struct Writer : ConsoleWriter
+  {
+    ~Writer() { writerStopped = true; }
+  } writer;
+  return writer;
+}
+
+// Collects the console output of a thread until a message is complete or the
+// stream is flushed
+class ThreadBuffer : public std::streambuf
+{
+public:
+  ThreadBuffer()
+    : mRing(getWriter().addRing())
+  {
+  }
+
+  ~ThreadBuffer()
+  {
+    submit();
+    mRing->closed = true;
+  }
+
+  // Hands the collected output to the writer
+  void submit()
+  {
+    if (!mPending.empty())
+      getWriter().submit(*mRing, mPending);
+  }
+
+protected:
+  int_type overflow(int_type c) override
+  {
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+      mPending += traits_type::to_char_type(c);
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char* s, std::streamsize n) override
+  {
+    mPending.append(s, n);
+    return n;
+  }
+
+  int sync() override
+  {
+    submit();
+    return 0;
+  }
+
+private:
+  std::shared_ptr<MessageRing> mRing;
+  std::string mPending;
+};
+
+// Console stream of a thread
+struct ThreadConsole
+{
+  ThreadBuffer buffer;
+  std::ostream stream{ &buffer };
+};
+
+ThreadConsole&
+getThreadConsole()
+{
+  thread_local ThreadConsole console;
+  return console;
+}
+
+} // namespace
+
+// Returns the empty message buffer of the calling thread for JSON messages
+static std::ostringstream&
+getMessageBuffer()
+{
+  thread_local std::ostringstream buffer;
+  buffer.str("");
+  return buffer;
+}
+
+// Returns the name of a log level in JSON messages
+static const char*
+getLogLevelName(LOG_LEVEL level)
+{
+  switch (level) {
+    case LOG_LEVEL::ERROR:
+      return "error";
+    case LOG_LEVEL::WARNING:
+      return "warning";
+    case LOG_LEVEL::INFO:
+      return "info";
+    case LOG_LEVEL::DEBUG:
+      return "debug";
+  }
+  return "";
+}
+
+// Appends text to json as a quoted JSON string
+static void
+appendJSONString(std::string& json, const std::string& text)
 {
-  if (validOutput)
-    std::cout << std::endl << std::flush;
+  json += '"';
+  for (unsigned char c : text) {
+    switch (c) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      case '\n':
+        json += "\\n";
+        break;
+      case '\r':
+        json += "\\r";
+        break;
+      case '\t':
+        json += "\\t";
+        break;
+      default:
+        if (c < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          json += escaped;
+        } else
+          json += c;
+    }
+  }
+  json += '"';
+}
+
+// Writes all buffered JSON messages
+static void
+flushJSONStream()
+{
+  std::lock_guard<std::mutex> guard(jsonLock);
+  if (jsonStream != nullptr)
+    jsonStream->flush();
+}
+
+MSG::Line::~Line()
+{
+  if (jsonOutput) {
+    char time[32];
+    snprintf(time, sizeof(time), "%.3f", Stats::getElapsedMilliseconds());
+
+    std::string json = "{\"time_ms\":";
+    json += time;
+    json += ",\"level\":\"";
+    json += getLogLevelName(logLevel);
+    json += '"';
+    const char* phase = Stats::getCurrentPhaseName();
+    if (*phase != '\0') {
+      json += ",\"phase\":\"";
+      json += phase;
+      json += '"';
+    }
+    if (!sourceFile.empty()) {
+      json += ",\"file\":";
+      appendJSONString(json, sourceFile);
+    }
+    if (position.line != 0) {
+      json += ",\"line\":" + std::to_string(position.line) +
+              ",\"column\":" + std::to_string(position.column);
+    }
+    json += ",\"message\":";
+    appendJSONString(json, static_cast<std::ostringstream&>(stream).str());
+    json += "}\n";
+
+    // Lines on std::cout are flushed at once for tools reading them live
+    std::lock_guard<std::mutex> guard(jsonLock);
+    *jsonStream << json;
+    if ((logLevel == LOG_LEVEL::ERROR) || (jsonStream == &std::cout))
+      jsonStream->flush();
+    return;
+  }
+
+  getStream() << '\n';
+
+  if (threadStream != nullptr || writerStopped)
+    return;
+
+  // Errors are written right away, everything else in the background
+  if (logLevel == LOG_LEVEL::ERROR)
+    flush();
+  else
+    getThreadConsole().buffer.submit();
 }
 
-MSG::MSG(LOG_LEVEL log_level, DEBUG dbg_level)
+MSG::Line::Line(LOG_LEVEL log_level, DEBUG /*dbg_level*/)
   : logLevel(log_level)
-  , debugLevel(dbg_level)
+  , stream(jsonOutput ? getMessageBuffer() : getStream())
+  , position{ 0, 0 }
 {
-  // Check if current log level passes threshold
+  // JSON messages carry their level in a field of their own
+  if (jsonOutput)
+    return;
+
+  // The MSG() macro already checked the threshold
   switch (logLevel) {
     case LOG_LEVEL::ERROR:
-      // Always show errors
-      std::cout << std::setw(10) << std::left << "\033[31m[Error]\033[0m ";
-      validOutput = true;
+      stream << std::setw(10) << std::left << "\033[31m[Error]\033[0m ";
       break;
     case LOG_LEVEL::WARNING:
-      if (MaxLogLevel != LOG_LEVEL::ERROR) {
-        std::cout << std::setw(10) << std::left << "\033[33m[Warning]\033[0m ";
-        validOutput = true;
-      }
+      stream << std::setw(10) << std::left << "\033[33m[Warning]\033[0m ";
       break;
     case LOG_LEVEL::INFO:
-      if (MaxLogLevel == LOG_LEVEL::DEBUG || MaxLogLevel == LOG_LEVEL::INFO) {
-        std::cout << std::setw(10) << std::left << "\033[32m[Info]\033[0m ";
-        validOutput = true;
-      }
+      stream << std::setw(10) << std::left << "\033[32m[Info]\033[0m ";
       break;
     case LOG_LEVEL::DEBUG:
-      if (MaxLogLevel == LOG_LEVEL::DEBUG) {
-        if (MaxDebugLevel != DEBUG::NONE || debugLevel == DEBUG::NONE) {
-          std::cout << std::setw(10) << std::left << "\033[36m[Debug]\033[0m ";
-          validOutput = true;
-        }
-      }
+      stream << std::setw(10) << std::left << "\033[36m[Debug]\033[0m ";
       break;
   }
 }
 
+// Stores the source position of the message. On the console it's printed
+// like compiler messages
+MSG::Line&
+MSG::Line::operator<<(const Position& position)
+{
+  this->position = position;
+  if (jsonOutput)
+    return *this;
+
+  if (sourceFile.empty())
+    stream << "line " << position.line << ", column " << position.column
+           << ": ";
+  else
+    stream << sourceFile << ":" << position.line << ":" << position.column
+           << ": ";
+  return *this;
+}
+
 // Set global message level
 void
 MSG::setLogLevel(LOG_LEVEL level)
@@ -138,3 +507,74 @@ MSG::getDebugLevelAsInt()
   }
   return -1;
 }
+
+// Redirect console output of the calling thread
+void
+MSG::setThreadStream(std::ostream* os)
+{
+  threadStream = os;
+}
+
+// Return console output stream of the calling thread
+std::ostream&
+MSG::getStream()
+{
+  if (threadStream != nullptr)
+    return *threadStream;
+  if (writerStopped)
+    return *consoleStream;
+  return getThreadConsole().stream;
+}
+
+// Wait until all queued console output is written
+void
+MSG::flush()
+{
+  flushJSONStream();
+  if (writerStopped)
+    return;
+  getThreadConsole().buffer.submit();
+  getWriter().flush();
+}
+
+// Print messages as JSON objects
+bool
+MSG::setJSONOutput(const std::string& fileName)
+{
+  // Output queued so far still goes to the previous streams
+  flush();
+
+  // The file is created once and never destroyed, so messages printed during
+  // exit are still safe. Further calls reopen it
+  static std::ofstream* file = nullptr;
+
+  std::lock_guard<std::mutex> guard(jsonLock);
+  if (fileName == "-") {
+    jsonStream = &std::cout;
+    consoleStream = &std::cerr;
+  } else {
+    if (file == nullptr) {
+      file = new std::ofstream();
+      std::atexit(flushJSONStream);
+    }
+    file->close();
+    file->clear();
+    file->open(fileName.c_str());
+    consoleStream = &std::cout;
+    if (!*file) {
+      jsonStream = nullptr;
+      jsonOutput = false;
+      return false;
+    }
+    jsonStream = file;
+  }
+  jsonOutput = true;
+  return true;
+}
+
+// Set the source file of the messages of the calling thread
+void
+MSG::setSourceFile(const std::string& fileName)
+{
+  sourceFile = fileName;
+}
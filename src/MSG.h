@@ -63,11 +63,48 @@ enum class DEBUG
 class MSG
 {
 public:
-  MSG(LOG_LEVEL log_level, DEBUG dbg_level = DEFAULT_DEBUG_LEVEL);
-  ~MSG();
-
-  template<typename T>
-  MSG& operator<<(T value);
+  // Position of a message in the VHDL source, streamed into a message like
+  // any other value. Lines and columns start at 1
+  struct Position
+  {
+    unsigned int line;
+    unsigned int column;
+  };
+
+  // A single message. It's only created by the MSG() macro if the message
+  // passes the current log level and is printed when it's destroyed
+  class Line
+  {
+  public:
+    Line(LOG_LEVEL log_level, DEBUG dbg_level = DEFAULT_DEBUG_LEVEL);
+    ~Line();
+
+    template<typename T>
+    Line& operator<<(const T& value);
+
+    Line& operator<<(const Position& position);
+
+  private:
+    // Message-specific log level
+    LOG_LEVEL logLevel;
+
+    // Receives the message text, the console or the JSON message buffer
+    std::ostream& stream;
+
+    // Source position of the message, line 0 if there's none
+    Position position;
+  };
+
+  // Turns "MSG::Line(...) << ..." into a void expression for the MSG() macro.
+  // operator& binds weaker than operator<<, so all values are streamed first
+  struct Voidify
+  {
+    void operator&(const Line&) {}
+  };
+
+  // Return true if a message with the given levels would be printed
+  static bool isEnabled(LOG_LEVEL log_level,
+                        DEBUG dbg_level = DEFAULT_DEBUG_LEVEL);
 
   // Set global message level
   static void setLogLevel(LOG_LEVEL level = DEFAULT_LOG_LEVEL);
@@ -83,39 +120,84 @@ public:
   static DEBUG getDebugLevel();
   static int getDebugLevelAsInt();
 
-private:
-  // Flag if current call will pass threshold and produce output
-  bool validOutput = false;
+  // Redirect console output of the calling thread into os. Passing nullptr
+  // restores the console
+  static void setThreadStream(std::ostream* os = nullptr);
+
+  // Return console output stream of the calling thread. Console output is
+  // queued per thread and written to std::cout by a background thread, each
+  // message or flushed chunk in one piece
+  static std::ostream& getStream();
+
+  // Wait until all queued console output is written to std::cout. Needed
+  // before anything else writes to the console, e.g. external tools
+  static void flush();
 
-  // Object-spcific log level
-  LOG_LEVEL logLevel;
+  // Print each message as a JSON object on a line of its own to fileName or
+  // to std::cout if fileName is "-". The other console output then goes to
+  // std::cerr, so std::cout only carries JSON lines. Returns false if the
+  // file can't be opened
+  static bool setJSONOutput(const std::string& fileName);
 
-  // Object-spcific debug level
-  DEBUG debugLevel;
+  // Set the source file the messages of the calling thread refer to. An
+  // empty name clears it
+  static void setSourceFile(const std::string& fileName = "");
 
+private:
   // Global maximum log level
   static LOG_LEVEL MaxLogLevel;
 
   // Global maximum debug level
   static DEBUG MaxDebugLevel;
+
+  // Per-thread output stream, nullptr if std::cout is used
+  static thread_local std::ostream* threadStream;
+
+  // Source file of the messages of the calling thread
+  static thread_local std::string sourceFile;
+
+  // Set if messages are printed as JSON objects
+  static bool jsonOutput;
 };
 
+// Check the log level before anything of the message is evaluated. With
+// VEC_STRIP_DEBUG defined debug messages are removed by the compiler
+inline bool
+MSG::isEnabled(LOG_LEVEL log_level, DEBUG dbg_level)
+{
+  switch (log_level) {
+    case LOG_LEVEL::ERROR:
+      return true;
+    case LOG_LEVEL::WARNING:
+      return MaxLogLevel != LOG_LEVEL::ERROR;
+    case LOG_LEVEL::INFO:
+      return MaxLogLevel == LOG_LEVEL::DEBUG || MaxLogLevel == LOG_LEVEL::INFO;
+    case LOG_LEVEL::DEBUG:
+#ifdef VEC_STRIP_DEBUG
+      return false;
+#else
+      return MaxLogLevel == LOG_LEVEL::DEBUG &&
+             (MaxDebugLevel != DEBUG::NONE || dbg_level == DEBUG::NONE);
+#endif
+  }
+  return false;
+}
+
 // Operator << overload to enable consecutive calls e.g. MSG() << "some" <<
 // "more";
 template<typename T>
-MSG&
-MSG::operator<<(T value)
+MSG::Line&
+MSG::Line::operator<<(const T& value)
 {
-  if (logLevel != LOG_LEVEL::DEBUG) {
-    if (logLevel <= MaxLogLevel) {
-      std::cout << value;
-    }
-  } else if (logLevel == LOG_LEVEL::DEBUG) {
-    if (validOutput) {
-      std::cout << value;
-    }
-  }
+  stream << value;
   return *this;
 }
 
+// Prints a message, e.g. MSG(LOG_LEVEL::INFO) << "Parsing " << fileName;
+// The streamed values are only evaluated if the message passes the current
+// log level. Being a single expression the macro is safe in if statements
+#define MSG(...)                                                               \
+  !MSG::isEnabled(__VA_ARGS__) ? (void)0                                       \
+                               : MSG::Voidify() & MSG::Line(__VA_ARGS__)
+
 #endif
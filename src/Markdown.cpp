@@ -32,21 +32,18 @@
 #include "Config.h"
 #include "MSG.h"
 
-Markdown::Markdown(VHDLEntity sourceEntity)
-  : OFileHandler(sourceEntity, "Markdown", "md", "markdown")
+Markdown::Markdown(const VHDLEntity& sourceEntity, std::ostream& os)
+  : OFileHandler(sourceEntity, os)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "Markdown::Markdown(VHDLEntity sourceEntity)";
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mConfigName = " << mConfigName;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mExtension = " << mExtension;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mSuffix = " << mSuffix;
+    << "Markdown::Markdown(const VHDLEntity& sourceEntity)";
 
   getMaxTextLengths();
 
   getHeader();
   getRows();
 
-  if (cfg.getBool("Table.exportGenerics")) {
+  if (mSettings.table.exportGenerics) {
     getGenerics();
   }
 }
@@ -58,9 +55,9 @@ Markdown::Polarity(int i)
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "Markdown::Polarity(int i)";
 
   if (mSourceEntity.getLOWActive(i) == true) {
-    return cfg.getString("Table.caption_LOWactive");
+    return mSettings.table.captionLOWactive;
   } else {
-    return cfg.getString("Table.caption_HIGHactive");
+    return mSettings.table.captionHIGHactive;
   }
 }
 
@@ -90,94 +87,94 @@ Markdown::getGenerics()
 
   if (mSourceEntity.getNumberOfGenerics() > 0) {
     // Build table headings
-    mOutputFile << std::endl << std::endl;
+    mOutput << '\n' << '\n';
 
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::GenericName,
-                cfg.getString("Table.GenericName"),
+                mSettings.table.genericName,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(colNames::GenericName,
-                cfg.getString("Table.GenericName"),
+                mSettings.table.genericName,
                 " ",
                 " ",
                 " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::GenericType,
-                cfg.getString("Table.GenericType"),
+                mSettings.table.genericType,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(colNames::GenericType,
-                cfg.getString("Table.GenericType"),
+                mSettings.table.genericType,
                 " ",
                 " ",
                 " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.boldHeadings"))
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::DefaultValue,
-                cfg.getString("Table.GenericDefaultValue"),
+                mSettings.table.genericDefaultValue,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(colNames::DefaultValue,
-                cfg.getString("Table.GenericDefaultValue"),
+                mSettings.table.genericDefaultValue,
                 " ",
                 " ",
                 " ");
 
-    mOutputFile << "|";
-    mOutputFile << std::endl;
+    mOutput << "|";
+    mOutput << '\n';
 
     // Build table hline
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.centeredGenericName"))
+    if (mSettings.table.centeredGenericName)
       writeCell(colNames::GenericName, "", ":", ":", "-", true);
     else
       writeCell(colNames::GenericName, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.centeredGenericType"))
+    if (mSettings.table.centeredGenericType)
       writeCell(colNames::GenericType, "", ":", ":", "-", true);
     else
       writeCell(colNames::GenericType, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
 
-    if (cfg.getBool("Table.centeredGenericDefaultValue"))
+    if (mSettings.table.centeredGenericDefaultValue)
       writeCell(colNames::DefaultValue, "", ":", ":", "-", true);
     else
       writeCell(colNames::DefaultValue, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
 
-    mOutputFile << std::endl;
+    mOutput << '\n';
 
     // Build table content
     for (int i = 0; i < mSourceEntity.getNumberOfGenerics(); i++) {
-      mOutputFile << "|";
+      mOutput << "|";
       writeCell(
         colNames::GenericName, mSourceEntity.getGenericName(i), " ", " ", " ");
-      mOutputFile << "|";
+      mOutput << "|";
 
       std::string tmpStr = mSourceEntity.getGenericType(i);
 
-      if (cfg.getBool("Table.showArrayLength") &&
+      if (mSettings.table.showArrayLength &&
           mSourceEntity.getGenericIsVector(i)) {
-        if (cfg.getBool("Table.arrayNotation"))
+        if (mSettings.table.arrayNotation)
           tmpStr +=
             "[" + std::to_string(mSourceEntity.getGenericVectorLength(i)) + "]";
         else
@@ -187,15 +184,15 @@ Markdown::getGenerics()
       }
       writeCell(colNames::GenericType, tmpStr, " ", " ", " ");
 
-      mOutputFile << "|";
+      mOutput << "|";
       writeCell(colNames::DefaultValue,
                 mSourceEntity.getGenericDefaultValue(i),
                 " ",
                 " ",
                 " ");
-      mOutputFile << "|";
+      mOutput << "|";
 
-      mOutputFile << std::endl;
+      mOutput << '\n';
     }
   }
 }
@@ -206,174 +203,174 @@ Markdown::getHeader()
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "Markdown::getHeader()";
 
-  mOutputFile << "|";
+  mOutput << "|";
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     writeCell(
-      colNames::Name, cfg.getString("Table.Name_heading"), " **", "** ", " ");
+      colNames::Name, mSettings.table.nameHeading, " **", "** ", " ");
   else
     writeCell(
-      colNames::Name, cfg.getString("Table.Name_heading"), " ", " ", " ");
+      colNames::Name, mSettings.table.nameHeading, " ", " ", " ");
 
-  mOutputFile << "|";
+  mOutput << "|";
 
-  if ((cfg.getBool("Table.exportType")) &&
-      !cfg.getBool("Table.combineNameAndType")) {
-    if (cfg.getBool("Table.boldHeadings"))
+  if ((mSettings.table.exportType) &&
+      !mSettings.table.combineNameAndType) {
+    if (mSettings.table.boldHeadings)
       writeCell(
-        colNames::Type, cfg.getString("Table.Type_heading"), " **", "** ", " ");
+        colNames::Type, mSettings.table.typeHeading, " **", "** ", " ");
     else
       writeCell(
-        colNames::Type, cfg.getString("Table.Type_heading"), " ", " ", " ");
+        colNames::Type, mSettings.table.typeHeading, " ", " ", " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportDirection")) {
-    if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.exportDirection) {
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Direction,
-                cfg.getString("Table.Direction_heading"),
+                mSettings.table.directionHeading,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(colNames::Direction,
-                cfg.getString("Table.Direction_heading"),
+                mSettings.table.directionHeading,
                 " ",
                 " ",
                 " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportPolarity")) {
-    if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.exportPolarity) {
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Polarity,
-                cfg.getString("Table.Polarity_heading"),
+                mSettings.table.polarityHeading,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(colNames::Polarity,
-                cfg.getString("Table.Polarity_heading"),
+                mSettings.table.polarityHeading,
                 " ",
                 " ",
                 " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportDescription")) {
-    if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.exportDescription) {
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Description,
-                cfg.getString("Table.Description_heading"),
+                mSettings.table.descriptionHeading,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(colNames::Description,
-                cfg.getString("Table.Description_heading"),
+                mSettings.table.descriptionHeading,
                 " ",
                 " ",
                 " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportBlank1")) {
-    if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.exportBlank1) {
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Blank,
-                cfg.getString("Table.Blank1_heading"),
+                mSettings.table.blank1Heading,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(
-        colNames::Blank, cfg.getString("Table.Blank1_heading"), " ", " ", " ");
+        colNames::Blank, mSettings.table.blank1Heading, " ", " ", " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportBlank2")) {
-    if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.exportBlank2) {
+    if (mSettings.table.boldHeadings)
       writeCell(colNames::Blank,
-                cfg.getString("Table.Blank2_heading"),
+                mSettings.table.blank2Heading,
                 " **",
                 "** ",
                 " ");
     else
       writeCell(
-        colNames::Blank, cfg.getString("Table.Blank2_heading"), " ", " ", " ");
+        colNames::Blank, mSettings.table.blank2Heading, " ", " ", " ");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
-  mOutputFile << "\n";
+  mOutput << "\n";
 
   // Hline
-  mOutputFile << "|";
+  mOutput << "|";
 
-  if (cfg.getBool("Table.centeredName")) {
+  if (mSettings.table.centeredName) {
     writeCell(colNames::Name, "", ":", ":", "-", true);
   } else
     writeCell(colNames::Name, "", "", "", "-");
 
-  mOutputFile << "|";
+  mOutput << "|";
 
-  if ((cfg.getBool("Table.exportType")) &&
-      !cfg.getBool("Table.combineNameAndType")) {
-    if (cfg.getBool("Table.centeredType")) {
+  if ((mSettings.table.exportType) &&
+      !mSettings.table.combineNameAndType) {
+    if (mSettings.table.centeredType) {
       writeCell(colNames::Type, "", ":", ":", "-", true);
     } else
       writeCell(colNames::Type, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportDirection")) {
-    if (cfg.getBool("Table.centeredDirection")) {
+  if (mSettings.table.exportDirection) {
+    if (mSettings.table.centeredDirection) {
       writeCell(colNames::Direction, "", ":", ":", "-", true);
     } else
       writeCell(colNames::Direction, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportPolarity")) {
-    if (cfg.getBool("Table.centeredPolarity")) {
+  if (mSettings.table.exportPolarity) {
+    if (mSettings.table.centeredPolarity) {
       writeCell(colNames::Polarity, "", ":", ":", "-", true);
     } else
       writeCell(colNames::Polarity, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportDescription")) {
-    if (cfg.getBool("Table.centeredDescription")) {
+  if (mSettings.table.exportDescription) {
+    if (mSettings.table.centeredDescription) {
       writeCell(colNames::Description, "", ":", ":", "-", true);
     } else
       writeCell(colNames::Description, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportBlank1")) {
-    if (cfg.getBool("Table.centeredBlank")) {
+  if (mSettings.table.exportBlank1) {
+    if (mSettings.table.centeredBlank) {
       writeCell(colNames::Blank, "", ":", ":", "-", true);
     } else
       writeCell(colNames::Blank, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
 
-  if (cfg.getBool("Table.exportBlank2")) {
-    if (cfg.getBool("Table.centeredBlank")) {
+  if (mSettings.table.exportBlank2) {
+    if (mSettings.table.centeredBlank) {
       writeCell(colNames::Blank, "", ":", ":", "-", true);
     } else
       writeCell(colNames::Blank, "", "", "", "-");
 
-    mOutputFile << "|";
+    mOutput << "|";
   }
-  mOutputFile << "\n";
+  mOutput << "\n";
 }
 
 // Generate the table content
@@ -389,63 +386,63 @@ Markdown::getRows()
   // Loop through all ports
   for (int i = 0; i < noPorts; i++) {
     // Create rows
-    mOutputFile << "|";
+    mOutput << "|";
 
     std::string tmpStr = mSourceEntity.getPortName(i);
 
-    if (cfg.getBool("Table.showArrayLength") && mSourceEntity.isVector(i) &&
-        cfg.getBool("Table.combineNameAndType")) {
-      if (cfg.getBool("Table.arrayNotation"))
+    if (mSettings.table.showArrayLength && mSourceEntity.isVector(i) &&
+        mSettings.table.combineNameAndType) {
+      if (mSettings.table.arrayNotation)
         tmpStr += "[" + mSourceEntity.getVectorStr(i) + "]";
       else
         tmpStr += "[" + mSourceEntity.getVectorStartStr(i) + ":" +
                   mSourceEntity.getVectorEndStr(i) + "]";
     }
     writeCell(colNames::Name, tmpStr, " ", " ", " ");
-    mOutputFile << "|";
+    mOutput << "|";
 
     tmpStr.clear();
-    if ((cfg.getBool("Table.exportType")) &&
-        !cfg.getBool("Table.combineNameAndType")) {
+    if ((mSettings.table.exportType) &&
+        !mSettings.table.combineNameAndType) {
       tmpStr += Type(i);
-      if (cfg.getBool("Table.showArrayLength") && mSourceEntity.isVector(i) &&
-          !cfg.getBool("Table.combineNameAndType")) {
-        if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.showArrayLength && mSourceEntity.isVector(i) &&
+          !mSettings.table.combineNameAndType) {
+        if (mSettings.table.arrayNotation)
           tmpStr += "[" + mSourceEntity.getVectorStr(i) + "]";
         else
           tmpStr += "[" + mSourceEntity.getVectorStartStr(i) + ":" +
                     mSourceEntity.getVectorEndStr(i) + "]";
       }
       writeCell(colNames::Type, tmpStr, " ", " ", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    if (cfg.getBool("Table.exportDirection")) {
+    if (mSettings.table.exportDirection) {
       writeCell(colNames::Direction, Direction(i), " ", " ", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    if (cfg.getBool("Table.exportPolarity")) {
+    if (mSettings.table.exportPolarity) {
       writeCell(colNames::Polarity, Polarity(i), " ", " ", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    if (cfg.getBool("Table.exportDescription")) {
+    if (mSettings.table.exportDescription) {
       writeCell(colNames::Description, "", "", "", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    if (cfg.getBool("Table.exportBlank1")) {
+    if (mSettings.table.exportBlank1) {
       writeCell(colNames::Blank, "", "", "", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    if (cfg.getBool("Table.exportBlank2")) {
+    if (mSettings.table.exportBlank2) {
       writeCell(colNames::Blank, "", "", "", " ");
-      mOutputFile << "|";
+      mOutput << "|";
     }
 
-    mOutputFile << "\n";
+    mOutput << "\n";
   }
 }
 
@@ -474,9 +471,9 @@ Markdown::getMaxTextLengths()
     colWidthType = max(colWidthType, mSourceEntity.getPortTypeStr(i).length());
 
     if (mSourceEntity.isVector(i)) {
-      if (cfg.getBool("Table.showArrayLength")) {
-        if (cfg.getBool("Table.combineNameAndType")) {
-          if (cfg.getBool("Table.arrayNotation"))
+      if (mSettings.table.showArrayLength) {
+        if (mSettings.table.combineNameAndType) {
+          if (mSettings.table.arrayNotation)
             colWidthName = max(colWidthName,
                                mSourceEntity.getPortName(i).length() +
                                  mSourceEntity.getVectorStr(i).length() + 2);
@@ -485,8 +482,8 @@ Markdown::getMaxTextLengths()
                                mSourceEntity.getPortName(i).length() +
                                  mSourceEntity.getVectorStartStr(i).length() +
                                  mSourceEntity.getVectorEndStr(i).length() + 3);
-        } else if (cfg.getBool("Table.exportType")) {
-          if (cfg.getBool("Table.arrayNotation"))
+        } else if (mSettings.table.exportType) {
+          if (mSettings.table.arrayNotation)
             colWidthType = max(colWidthType,
                                mSourceEntity.getPortTypeStr(i).length() +
                                  mSourceEntity.getVectorStr(i).length() + 2);
@@ -509,36 +506,36 @@ Markdown::getMaxTextLengths()
       max(colWidthGenericType, mSourceEntity.getGenericType(i).length());
   }
 
-  if (cfg.getBool("Table.boldHeadings"))
+  if (mSettings.table.boldHeadings)
     formattingCorrection = 4;
 
   colWidthName =
     max(colWidthName,
-        cfg.getString("Table.Name_heading").length() + formattingCorrection);
+        mSettings.table.nameHeading.length() + formattingCorrection);
   colWidthType =
     max(colWidthType,
-        cfg.getString("Table.Type_heading").length() + formattingCorrection);
+        mSettings.table.typeHeading.length() + formattingCorrection);
   colWidthDirection = max(colWidthDirection,
-                          cfg.getString("Table.Direction_heading").length() +
+                          mSettings.table.directionHeading.length() +
                             formattingCorrection);
   colWidthPolarity = max(colWidthPolarity,
-                         cfg.getString("Table.Polarity_heading").length() +
+                         mSettings.table.polarityHeading.length() +
                            formattingCorrection);
   colWidthDescription = max(
     colWidthDescription,
-    cfg.getString("Table.Description_heading").length() + formattingCorrection);
+    mSettings.table.descriptionHeading.length() + formattingCorrection);
   colWidthBlank =
     max(colWidthBlank,
-        cfg.getString("Table.Blank1_heading").length() + formattingCorrection);
+        mSettings.table.blank1Heading.length() + formattingCorrection);
   colWidthBlank =
     max(colWidthBlank,
-        cfg.getString("Table.Blank2_heading").length() + formattingCorrection);
+        mSettings.table.blank2Heading.length() + formattingCorrection);
   colWidthGenericName =
     max(colWidthGenericName,
-        cfg.getString("Table.Name_heading").length() + formattingCorrection);
+        mSettings.table.nameHeading.length() + formattingCorrection);
   colWidthGenericType =
     max(colWidthGenericType,
-        cfg.getString("Table.Type_heading").length() + formattingCorrection);
+        mSettings.table.typeHeading.length() + formattingCorrection);
   colWidthDefaultValue =
     max(colWidthDefaultValue,
         std::string("Default value").length() + formattingCorrection);
@@ -615,14 +612,14 @@ Markdown::writeCell(colNames column,
       break;
   }
 
-  mOutputFile << prefix;
+  mOutput << prefix;
   textLength += prefix.length();
 
-  mOutputFile << text;
+  mOutput << text;
   textLength += text.length();
 
   if (!formatting) {
-    mOutputFile << suffix;
+    mOutput << suffix;
     textLength += suffix.length();
 
     if (textLength < maxTextLength) {
@@ -631,7 +628,7 @@ Markdown::writeCell(colNames column,
 
       for (size_t i = 0; i < maxTextLength - textLength; i++) {
         MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "fillChar";
-        mOutputFile << fillChar;
+        mOutput << fillChar;
       }
     }
   } else {
@@ -642,11 +639,11 @@ Markdown::writeCell(colNames column,
       for (size_t i = 0; i < maxTextLength - textLength - suffix.length();
            i++) {
         MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "fillChar";
-        mOutputFile << fillChar;
+        mOutput << fillChar;
       }
     }
 
-    mOutputFile << suffix;
+    mOutput << suffix;
     textLength += suffix.length();
   }
 }
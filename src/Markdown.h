@@ -53,7 +53,8 @@ private:
   std::string Type(int i);      // Get type string of required port
 
 public:
-  Markdown(VHDLEntity sourceEntity);
+  // Renders sourceEntity into os
+  Markdown(const VHDLEntity& sourceEntity, std::ostream& os);
 };
 
 #endif
\ No newline at end of file
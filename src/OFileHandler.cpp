@@ -32,98 +32,257 @@
 #include "OFileHandler.h"
 #include "Config.h"
 #include "MSG.h"
+#include "Stats.h"
 #include "tools.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <filesystem>
+#include <mutex>
+#include <set>
 #include <stdlib.h>
-#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Output directories which were created or found to exist by this process
+static std::set<std::string> createdDirectories;
+static std::mutex createdDirectoriesLock;
+
+// Opens filePath for writing, returns the file descriptor or -1
+static int
+openOutputFile(const std::string& filePath, bool binary)
+{
+#ifdef _WIN32
+  // Text mode keeps the CRLF line endings of the former ofstream output
+  int mode = binary ? _O_BINARY : _O_TEXT;
+  return _open(filePath.c_str(),
+               _O_WRONLY | _O_CREAT | _O_TRUNC | mode,
+               _S_IREAD | _S_IWRITE);
+#else
+  // There's no text mode
+  (void)binary;
+  return open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+#endif
+}
+
+std::atomic<unsigned int> OFileHandler::writtenFiles(0);
+std::atomic<unsigned int> OFileHandler::unchangedFiles(0);
 
 // ...
-OFileHandler::OFileHandler(VHDLEntity sourceEntity,
-                           std::string configName,
-                           std::string extension,
-                           std::string suffix)
-  : mSourceEntity(sourceEntity)
-  , mConfigName(configName)
-  , mExtension(extension)
-  , mSuffix(suffix)
+OFileHandler::OFileHandler(const VHDLEntity& sourceEntity, std::ostream& os)
+  : mOutput(os)
+  , mSourceEntity(sourceEntity)
+  , mSettings(cfg.getSnapshot())
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "OFileHandler::OFileHandler(VHDLEntity sourceEntity)";
-  // MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mConfigName = " << mConfigName;
-  // MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mExtension = " << mExtension;
-  // MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mSuffix = " << mSuffix;
+}
 
-  mOutputDirectory = cleanPath(cfg.getString(mConfigName + ".outputPath"));
+// Destructor
+OFileHandler::~OFileHandler()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "OFileHandler::~OFileHandler()";
+}
+
+std::string
+OFileHandler::getOutputFilePath(std::string outputDirectory,
+                                const std::string& entityName,
+                                const std::string& extension,
+                                const std::string& suffix)
+{
+  std::string outputFileName;
+  std::string outputFilePath;
+
+  outputDirectory = cleanPath(outputDirectory);
 
   // Build file name string
-  if (mSuffix.empty())
-    mOutputFileName = mSourceEntity.getEntityName() + "." + mExtension;
+  if (suffix.empty())
+    outputFileName = entityName + "." + extension;
   else
-    mOutputFileName =
-      mSourceEntity.getEntityName() + "." + mSuffix + "." + mExtension;
+    outputFileName = entityName + "." + suffix + "." + extension;
 
-  if (!mOutputDirectory.empty()) {
+  if (!outputDirectory.empty()) {
 #ifdef _WIN32
-    mOutputFilePath = mOutputDirectory + "\\" + mOutputFileName;
+    outputFilePath = outputDirectory + "\\" + outputFileName;
 #else
-    mOutputFilePath = mOutputDirectory + "/" + mOutputFileName;
+    outputFilePath = outputDirectory + "/" + outputFileName;
 #endif
   } else {
-#ifdef _WIN32
-    mOutputFilePath = mOutputFileName;
-#else
-    mOutputFilePath = mOutputFileName;
-#endif
+    outputFilePath = outputFileName;
   }
 
-  createOutputDirectory();
+  createOutputDirectory(outputDirectory);
 
-  // MSG(LOG_LEVEL::INFO) << TAB << "filename = " << mOutputFileName;
-  // MSG(LOG_LEVEL::INFO) << TAB << "directory = " << mOutputDirectory;
-  MSG(LOG_LEVEL::INFO) << TAB << "filepath = " << mOutputFilePath;
+  MSG(LOG_LEVEL::INFO) << TAB << "filepath = " << outputFilePath;
 
-  mOutputFile.open((char*)mOutputFilePath.c_str());
+  return outputFilePath;
 }
 
-// Destructor
-OFileHandler::~OFileHandler()
+bool
+OFileHandler::writeFile(const std::string& filePath,
+                        const std::string& content,
+                        bool sync,
+                        bool binary)
 {
-  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "OFileHandler::~OFileHandler()";
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "OFileHandler::writeFile(" << filePath << ")";
 
-  mOutputFile.close();
-}
+  // Keep files with identical content, so tools watching the output
+  // directories don't rebuild them
+  if (hasContent(filePath, content, binary)) {
+    MSG(LOG_LEVEL::INFO) << TAB << filePath << " unchanged";
+    unchangedFiles++;
+    return true;
+  }
 
-int
-OFileHandler::createOutputDirectory()
-{
-  // Add trailing slash to output path if there's none
+  int fd = openOutputFile(filePath, binary);
+
+  // The output directory may have been removed since it was created, e.g.
+  // while watching the sources or serving requests. It's created again once
+  if ((fd < 0) && (errno == ENOENT)) {
+    std::string directory =
+      std::filesystem::path(filePath).parent_path().string();
+    if (!directory.empty()) {
+      {
+        std::lock_guard<std::mutex> guard(createdDirectoriesLock);
+        createdDirectories.erase(directory);
+      }
+      if (createOutputDirectory(directory) == 0)
+        fd = openOutputFile(filePath, binary);
+    }
+  }
+
+  if (fd < 0) {
+    MSG(LOG_LEVEL::ERROR) << "Can't open output file " << filePath;
+    return false;
+  }
+
+  // A single call is enough for regular files, the loop only handles
+  // interrupted or partial writes
+  const char* data = content.data();
+  size_t remaining = content.size();
+  bool success = true;
+  while (remaining > 0) {
 #ifdef _WIN32
-  if (!(mOutputDirectory.empty()) &&
-      (mOutputDirectory[mOutputDirectory.length() - 1] != '\\'))
-    mOutputDirectory.append("\\");
+    int written = _write(fd, data, (unsigned int)remaining);
 #else
-  if (!(mOutputDirectory.empty()) &&
-      (mOutputDirectory[mOutputDirectory.length() - 1] != '/'))
-    mOutputDirectory.append("/");
+    ssize_t written = write(fd, data, remaining);
 #endif
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      success = false;
+      break;
+    }
+    data += written;
+    remaining -= written;
+  }
 
-  // Check if directory already exists
-  struct stat st;
-  if (stat((char*)(mOutputDirectory).c_str(), &st) == 0) {
-    MSG(LOG_LEVEL::DEBUG) << "Output directory already exists";
-  } else {
-    // Create new directory if required
-    if (!mOutputDirectory.empty()) {
-      // Build arg string. Suppress output and stderr
+  if (success && sync) {
 #ifdef _WIN32
-      std::string cmd = "mkdir \"" + mOutputDirectory + "\" > nul 2> nul";
+    success = (_commit(fd) == 0);
 #else
-      std::string cmd =
-        "mkdir \"" + mOutputDirectory + "\" >/dev/null 2>/dev/null";
+    success = (fsync(fd) == 0);
 #endif
-      MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT)
-        << "mkdir " << cmd << " = " << system(cmd.c_str());
-    }
   }
 
+#ifdef _WIN32
+  if (_close(fd) != 0)
+    success = false;
+#else
+  if (close(fd) != 0)
+    success = false;
+#endif
+
+  if (!success)
+    MSG(LOG_LEVEL::ERROR) << "Can't write output file " << filePath;
+  else {
+    writtenFiles++;
+    Stats::addBytesWritten(content.size());
+  }
+
+  return success;
+}
+
+bool
+OFileHandler::hasContent(const std::string& filePath,
+                         const std::string& content,
+                         bool binary)
+{
+  std::error_code ec;
+  std::uintmax_t size = std::filesystem::file_size(filePath, ec);
+  if (ec)
+    return false;
+
+#ifdef _WIN32
+  // Line endings of text files are converted, so the size on disk differs
+  if (binary && size != content.size())
+    return false;
+#else
+  if (size != content.size())
+    return false;
+#endif
+
+  std::ifstream file(filePath,
+                     binary ? std::ios::in | std::ios::binary : std::ios::in);
+  if (!file)
+    return false;
+
+  // Compare in blocks, so a difference is found without reading the rest
+  char block[16384];
+  size_t offset = 0;
+  while (file) {
+    file.read(block, sizeof(block));
+    size_t count = file.gcount();
+    if (offset + count > content.size() ||
+        content.compare(offset, count, block, count) != 0)
+      return false;
+    offset += count;
+  }
+
+  return offset == content.size();
+}
+
+unsigned int
+OFileHandler::getNumberOfWrittenFiles()
+{
+  return writtenFiles;
+}
+
+unsigned int
+OFileHandler::getNumberOfUnchangedFiles()
+{
+  return unchangedFiles;
+}
+
+int
+OFileHandler::createOutputDirectory(std::string outputDirectory)
+{
+  // Output files are written to the current directory
+  if (outputDirectory.empty())
+    return 0;
+
+  // Several jobs may create the same directory at once. The lock is held
+  // while the directory is created, so each directory is created only once
+  std::lock_guard<std::mutex> guard(createdDirectoriesLock);
+
+  // Check if directory was already created or found by this process
+  if (createdDirectories.count(outputDirectory) != 0)
+    return 0;
+
+  // Create the directory including all missing parent directories
+  std::error_code ec;
+  std::filesystem::create_directories(outputDirectory, ec);
+  if (ec) {
+    MSG(LOG_LEVEL::ERROR) << "Can't create output directory "
+                          << outputDirectory << " (" << ec.message() << ")";
+    return 1;
+  }
+
+  MSG(LOG_LEVEL::DEBUG) << "Output directory " << outputDirectory << " exists";
+  createdDirectories.insert(outputDirectory);
+
   return 0;
 }
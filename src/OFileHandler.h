@@ -9,7 +9,7 @@
 *	File: OFileHandler.h
 *	Author: Benjamin Wieneth
 *	Description: This class serves as a base class for all output file
-*	generators. It offers the creation and writing of files.
+*	generators. It offers the output stream and the creation of files.
 *
 *****************************************************************************
 *
@@ -32,9 +32,11 @@
 #ifndef OFILEHANDLER_H
 #define OFILEHANDLER_H
 
+#include "Config.h"
 #include "EntityPort.h"
 #include "VHDLEntity.h"
 #include "tools.h"
+#include <atomic>
 #include <fstream>
 #include <ostream>
 #include <string>
@@ -42,16 +44,14 @@
 class OFileHandler
 {
 protected:
-  ofstream mOutputFile;
+  // Stream the generator renders into
+  std::ostream& mOutput;
 
-  VHDLEntity mSourceEntity;
-  std::string mOutputDirectory;
-  std::string mOutputFileName;
-  std::string mOutputFilePath;
-  int createOutputDirectory();
-  std::string mConfigName;
-  std::string mExtension;
-  std::string mSuffix;
+  // Parsed entity, owned by the caller
+  const VHDLEntity& mSourceEntity;
+
+  // Typed config values, resolved once before the output files are created
+  const ConfigSnapshot& mSettings;
 
   size_t colWidthName;
   size_t colWidthType;
@@ -77,11 +77,41 @@ protected:
   };
 
 public:
-  OFileHandler(VHDLEntity sourceEntity,
-               std::string configName = "",
-               std::string extension = "txt",
-               std::string suffix = "");
+  // Renders sourceEntity into os
+  OFileHandler(const VHDLEntity& sourceEntity, std::ostream& os);
   ~OFileHandler();
+
+  // Builds the path of an output file from the output directory, the name of
+  // the entity and the file extension. Creates the output directory if needed
+  static std::string getOutputFilePath(std::string outputDirectory,
+                                       const std::string& entityName,
+                                       const std::string& extension,
+                                       const std::string& suffix = "");
+
+  // Writes content to the file at filePath with a single write call. If sync
+  // is set the file is flushed to disk before it's closed. Binary content
+  // keeps its line endings on Windows. Files which already have the same
+  // content aren't touched, so their modification time is kept
+  static bool writeFile(const std::string& filePath,
+                        const std::string& content,
+                        bool sync = false,
+                        bool binary = false);
+
+  // Number of files written or left unchanged by writeFile()
+  static unsigned int getNumberOfWrittenFiles();
+  static unsigned int getNumberOfUnchangedFiles();
+
+private:
+  // Returns true if the file at filePath has exactly the given content
+  static bool hasContent(const std::string& filePath,
+                         const std::string& content,
+                         bool binary);
+
+  static std::atomic<unsigned int> writtenFiles;
+  static std::atomic<unsigned int> unchangedFiles;
+
+  // Creates the given directory if it doesn't exist yet
+  static int createOutputDirectory(std::string outputDirectory);
 };
 
 #endif
@@ -0,0 +1,251 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: OfficeConverter.cpp
+*	Author: Benjamin Wießneth
+*	Description: Batched conversion of FODG files to PNG by LibreOffice
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "OfficeConverter.h"
+#include "Config.h"
+#include "MSG.h"
+#include "Stats.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// Each soffice call should convert at least this many files, otherwise the
+// startup of additional processes costs more than it saves
+static const size_t MIN_FILES_PER_CALL = 16;
+
+// Longest command passed to system(). cmd.exe accepts at most 8191 chars
+#ifdef _WIN32
+static const size_t MAX_COMMAND_LENGTH = 8000;
+#else
+static const size_t MAX_COMMAND_LENGTH = 100000;
+#endif
+
+std::vector<OfficeConverter::Conversion> OfficeConverter::mQueue;
+std::mutex OfficeConverter::mLock;
+
+// Quotes a single argument of a soffice call
+static std::string
+quote(const std::string& arg)
+{
+#ifdef _WIN32
+  return "\"" + arg + "\"";
+#else
+  return "\'" + arg + "\'";
+#endif
+}
+
+void
+OfficeConverter::queue(const std::string& fodgPath,
+                       const std::string& pngPath,
+                       const std::string& entityName)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "OfficeConverter::queue(" << fodgPath << ")";
+
+  std::lock_guard<std::mutex> guard(mLock);
+  mQueue.push_back({ fodgPath, pngPath, entityName });
+}
+
+unsigned int
+OfficeConverter::convertQueued(unsigned int jobs)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "OfficeConverter::convertQueued(" << jobs << ")";
+
+  std::vector<Conversion> files;
+  {
+    std::lock_guard<std::mutex> guard(mLock);
+    files.swap(mQueue);
+  }
+  if (files.empty())
+    return 0;
+
+  Stats::Timer timer(Stats::PHASE::LIBREOFFICE);
+
+  // Files are queued in the order the jobs finish
+  std::sort(files.begin(),
+            files.end(),
+            [](const Conversion& a, const Conversion& b) {
+              return a.fodgPath < b.fodgPath;
+            });
+
+  const std::string& sofficePath = cfg.getSnapshot().png.sofficePath;
+
+  // Check if a SO-Installation was specified
+  if (sofficePath.empty()) {
+    MSG(LOG_LEVEL::WARNING)
+      << "PATH.soffice not specified. Please edit your VEC.conf";
+    return files.size();
+  }
+
+  // soffice takes a single output directory per call
+  std::map<std::string, std::vector<Conversion>> directories;
+  for (const Conversion& file : files) {
+    std::string directory =
+      std::filesystem::path(file.pngPath).parent_path().string();
+    directories[directory.empty() ? "." : directory].push_back(file);
+
+    // Remove outdated PNG files, so failed conversions can be detected
+    std::error_code error;
+    std::filesystem::remove(file.pngPath, error);
+  }
+
+  if (jobs == 0)
+    jobs = ThreadPool::getHardwareThreads();
+
+  // Split the files of each directory into calls of similar size. Concurrent
+  // calls need their own user profile
+  size_t calls = std::max<size_t>(
+    1,
+    std::min<size_t>(jobs,
+                     (files.size() + MIN_FILES_PER_CALL - 1) /
+                       MIN_FILES_PER_CALL));
+  std::vector<std::vector<std::string>> commands(calls);
+  std::vector<std::string> profiles;
+
+  size_t index = 0;
+  for (const auto& directory : directories) {
+    for (size_t call = 0; call < calls; call++) {
+      std::vector<Conversion> chunk;
+      for (size_t i = call; i < directory.second.size(); i += calls)
+        chunk.push_back(directory.second[i]);
+      if (chunk.empty())
+        continue;
+
+      std::string profile;
+      if (calls > 1) {
+#ifdef _WIN32
+        int pid = _getpid();
+#else
+        int pid = getpid();
+#endif
+        profile = (std::filesystem::temp_directory_path() /
+                   ("vec_soffice_" + std::to_string(pid) + "_" +
+                    std::to_string(index++)))
+                    .string();
+        profiles.push_back(profile);
+      }
+
+      std::vector<std::string> chunkCommands =
+        buildCommands(chunk, directory.first, profile);
+      commands[call].insert(
+        commands[call].end(), chunkCommands.begin(), chunkCommands.end());
+    }
+  }
+
+  MSG(LOG_LEVEL::INFO) << "Converting " << files.size()
+                       << " FODG files to PNG using " << calls
+                       << " soffice processes";
+  for (const auto& callCommands : commands)
+    for (const std::string& command : callCommands)
+      MSG(LOG_LEVEL::INFO) << TAB << "SOFFICE call = " << command;
+
+  // Print pending messages before soffice writes to the console
+  MSG::flush();
+
+  if (calls == 1) {
+    for (const std::string& command : commands[0])
+      (void)!system(command.c_str());
+  } else {
+    ThreadPool pool(calls);
+    for (const auto& callCommands : commands) {
+      pool.submit([&callCommands] {
+        for (const std::string& command : callCommands)
+          (void)!system(command.c_str());
+      });
+    }
+    pool.wait();
+  }
+
+  for (const std::string& profile : profiles) {
+    std::error_code error;
+    std::filesystem::remove_all(profile, error);
+  }
+
+  // Map missing PNG files back to their entities
+  unsigned int failed = 0;
+  for (const Conversion& file : files) {
+    if (!std::filesystem::exists(file.pngPath)) {
+      MSG(LOG_LEVEL::ERROR) << "LibreOffice couldn't convert " << file.fodgPath
+                            << " of entity " << file.entityName << " to PNG";
+      failed++;
+    }
+  }
+
+  return failed;
+}
+
+std::vector<std::string>
+OfficeConverter::buildCommands(const std::vector<Conversion>& files,
+                               const std::string& outputDirectory,
+                               const std::string& profile)
+{
+  const std::string& sofficePath = cfg.getSnapshot().png.sofficePath;
+
+  std::string prefix = quote(sofficePath);
+  if (!profile.empty()) {
+    // The profile is passed as file URL
+    std::string url = std::filesystem::path(profile).generic_string();
+    if (url[0] != '/')
+      url = "/" + url;
+    prefix += " " + quote("-env:UserInstallation=file://" + url);
+  }
+  prefix += " --headless --convert-to png:\"draw_png_Export\" --outdir " +
+            quote(outputDirectory);
+
+  std::vector<std::string> commands;
+  std::string command = prefix;
+  for (size_t i = 0; i < files.size(); i++) {
+    std::string arg = " " + quote(files[i].fodgPath);
+    if (command.size() + arg.size() + 2 > MAX_COMMAND_LENGTH &&
+        command.size() > prefix.size()) {
+      commands.push_back(command);
+      command = prefix;
+    }
+    command += arg;
+  }
+  commands.push_back(command);
+
+#ifdef _WIN32
+  // cmd.exe strips the outer quotes of the whole command
+  for (std::string& c : commands)
+    c = "\"" + c + "\"";
+#endif
+
+  return commands;
+}
@@ -0,0 +1,75 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: OfficeConverter.h
+*	Author: Benjamin Wießneth
+*	Description: Batched conversion of FODG files to PNG by LibreOffice
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef OFFICECONVERTER_H
+#define OFFICECONVERTER_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Converts FODG files to PNG with LibreOffice. Files are collected during a
+// run and converted by a few soffice calls at the end, so the startup time of
+// LibreOffice is only spent once per call instead of once per entity
+class OfficeConverter
+{
+public:
+  // Queues the conversion of fodgPath. LibreOffice writes the PNG file to the
+  // directory of pngPath. May be called from several worker threads
+  static void queue(const std::string& fodgPath,
+                    const std::string& pngPath,
+                    const std::string& entityName);
+
+  // Converts all queued files and clears the queue. The files are split into
+  // at most jobs soffice calls which run concurrently, 0 uses one call per
+  // hardware thread. Returns the number of PNG files which weren't created
+  static unsigned int convertQueued(unsigned int jobs);
+
+private:
+  struct Conversion
+  {
+    std::string fodgPath;
+    std::string pngPath;
+    std::string entityName;
+  };
+
+  // Builds the soffice calls converting files into outputDirectory. A
+  // separate user profile is used if profile isn't empty, as concurrent
+  // soffice processes can't share one
+  static std::vector<std::string> buildCommands(
+    const std::vector<Conversion>& files,
+    const std::string& outputDirectory,
+    const std::string& profile);
+
+  static std::vector<Conversion> mQueue;
+  static std::mutex mLock;
+};
+
+#endif
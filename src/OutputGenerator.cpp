@@ -36,38 +36,48 @@
 #include "LaTeX.h"
 #include "MSG.h"
 #include "Markdown.h"
+#include "OfficeConverter.h"
+#include "PNGWriter.h"
 #include "SVG.h"
+#include "Stats.h"
+
+#include <streambuf>
 
 OutputGenerator::OutputGenerator(std::string sourcePath,
-                                 VHDLEntity sourceEntity)
+                                 const VHDLEntity& sourceEntity)
+  : mSourceEntity(sourceEntity)
+  , mFailed(false)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "OutputGenerator::OutputGenerator(std::string sourcePath, VHDLEntity "
        "sourceEntity)";
 
   mSourcePath = sourcePath;
-  mSourceEntity = sourceEntity;
   mSourceName = mSourceEntity.getEntityName();
 
   // Check if source entity has a valid name and path
   if (mSourceName.empty() || mSourcePath.empty()) {
     MSG(LOG_LEVEL::ERROR) << "Empty source name or source path.";
+    mFailed = true;
   } else {
     // Start to generate the OpenDocument file. This is needed for some
     // subsequent steps
-    if ((cfg.getBool("FODG.enableExport")) || (cfg.getBool("PNG.enableExport")))
+    const ConfigSnapshot& settings = cfg.getSnapshot();
+
+    if (settings.fodgExport.enable ||
+        (settings.pngExport.enable && settings.png.useLibreOffice))
       generateFODG();
 
     // Create several other output formats if requested
-    if (cfg.getBool("SVG.enableExport"))
+    if (settings.svgExport.enable)
       generateSVG();
-    if (cfg.getBool("PNG.enableExport"))
+    if (settings.pngExport.enable)
       generatePNG();
-    if (cfg.getBool("DokuWiki.enableExport"))
+    if (settings.dokuWikiExport.enable)
       generateDokuWikiMarkup();
-    if (cfg.getBool("Markdown.enableExport"))
+    if (settings.markdownExport.enable)
       generateMarkdown();
-    if (cfg.getBool("LaTeX.enableExport"))
+    if (settings.laTeXExport.enable)
       generateLaTeX();
   }
 }
@@ -79,8 +89,7 @@ OutputGenerator::generateFODG()
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "OutputGenerator::generateFODG()";
 
-  // Pass the source entity to the FODGTranslator
-  FODG mFODG(mSourceEntity);
+  writeOutputFile(FORMAT::FODG);
   return;
 }
 
@@ -91,11 +100,12 @@ OutputGenerator::generateSVG()
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "OutputGenerator::generateFODG()";
 
-  SVG mSVG(mSourceEntity);
+  writeOutputFile(FORMAT::SVG);
   return;
 }
 
-// Generate a PNG file by utilizing the LibreOffice conversion tool
+// Generate a PNG file with the built-in rasterizer. If PNG.useLibreOffice is
+// set the FODG file is queued for the LibreOffice conversion tool instead
 void
 OutputGenerator::generatePNG()
 {
@@ -103,71 +113,35 @@ OutputGenerator::generatePNG()
     << "OutputGenerator::generatePNG()";
   MSG(LOG_LEVEL::INFO) << "Generating PNG file";
 
-  // Initialize common vars
-  std::string arg = "\"\"";
-  std::string SOFFICE_path = cfg.getString(
-    "PATH.soffice"); // Get path to the StarOffice / Libre Office installation
-  std::string outputPath = cfg.getString(
-    "PNG.outputPath"); // If the user didn't specify a output path via command
-                       // line arg read the default from config file
-
-  // Get path to put output files in
-  std::string fPath = getOutputPath(mSourcePath);
-
-#ifdef _WIN32
-  if (!fPath.empty())
-    fPath = cleanPath(fPath) + "\\" +
-            cleanPath(cfg.getString("FODG.outputPath")) + "\\" + mSourceName;
-  else
-    fPath = cleanPath(cfg.getString("FODG.outputPath")) + "\\" + mSourceName;
-#else
-  if (!fPath.empty())
-    fPath = cleanPath(fPath) + "/" +
-            cleanPath(cfg.getString("FODG.outputPath")) + "/" + mSourceName;
-  else
-    fPath = cleanPath(cfg.getString("FODG.outputPath")) + "/" + mSourceName;
-#endif
+  if (!cfg.getSnapshot().png.useLibreOffice) {
+    writeOutputFile(FORMAT::PNG);
+    return;
+  }
 
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "PNG.outputPath = " << outputPath;
+  // The FODG file was already written by generateFODG(). LibreOffice is
+  // started once for all queued files after the last source file
+  const ConfigSnapshot& settings = cfg.getSnapshot();
+  std::string pngPath = OFileHandler::getOutputFilePath(
+    settings.pngExport.outputPath, mSourceName, "png");
+  OfficeConverter::queue(OFileHandler::getOutputFilePath(
+                           settings.fodgExport.outputPath, mSourceName, "fodg"),
+                         pngPath,
+                         mSourceName);
+  mOutputFiles.push_back(pngPath);
+}
 
-  // Check if a SO-Installation was specified
-  if (SOFFICE_path.empty()) {
-    MSG(LOG_LEVEL::WARNING)
-      << "PATH.soffice not specified. Please edit your VEC.conf";
-  } else {
-#ifdef _WIN32
-    // Build the arg string to pass
-    arg += SOFFICE_path +
-           "\" --headless --convert-to png:\"draw_png_Export\" \"" + fPath +
-           ".fodg\" --outdir \"";
-#else
-    // Build the arg string to pass
-    arg = "\'";
-    arg += SOFFICE_path +
-           "\' --headless  --convert-to png:\"draw_png_Export\" \'" + fPath +
-           ".fodg\' --outdir \'";
-#endif
-
-    // If no output path was set via cmd line argument or config file use
-    // directory of the executable
-    if (outputPath.empty())
-      arg += cleanPath(cfg.getString("FODG.outputPath"));
-    else
-      arg += cleanPath(outputPath);
-
-#ifdef _WIN32
-    // End arg string with quotes
-    arg += "\"\"";
-#else
-    // End arg string with hard quotes
-    arg += "\'";
-#endif
-
-    MSG(LOG_LEVEL::INFO) << TAB << "SOFFICE call = " << arg;
-
-    // Execute arg string
-    (void)!system(arg.c_str());
-  }
+// Return the paths of the created output files
+const std::vector<std::string>&
+OutputGenerator::getOutputFiles() const
+{
+  return mOutputFiles;
+}
+
+// Return true if an output file couldn't be created
+bool
+OutputGenerator::hasFailed() const
+{
+  return mFailed;
 }
 
 // Generate a DokuWiki table source file
@@ -178,7 +152,7 @@ OutputGenerator::generateDokuWikiMarkup()
     << "OutputGenerator::generateDokuWikiMarkup()";
   MSG(LOG_LEVEL::INFO) << "Generating DokuWiki markup";
 
-  DWMarkup mDWMarkup(mSourceEntity);
+  writeOutputFile(FORMAT::DokuWiki);
   return;
 }
 
@@ -190,7 +164,7 @@ OutputGenerator::generateMarkdown()
     << "OutputGenerator::generateMarkdown()";
   MSG(LOG_LEVEL::INFO) << "Generating markdown";
 
-  Markdown mMarkdown(mSourceEntity);
+  writeOutputFile(FORMAT::Markdown);
   return;
 }
 
@@ -202,21 +176,206 @@ OutputGenerator::generateLaTeX()
     << "OutputGenerator::generateLaTeX()";
   MSG(LOG_LEVEL::INFO) << "Generating LaTeX";
 
-  LaTeX mLaTeX(mSourceEntity);
+  writeOutputFile(FORMAT::LaTeX);
   return;
 }
 
-// Exclude filename (e.g. microdata.vhd) from filepath to get output directory
-// (e.g. input = C:\VEC\microdata.vhd -> output = C:\VEC\)
+// Returns the layout of entity for format. Tables get an empty one
+static Layout
+computeLayout(OutputGenerator::FORMAT format, const VHDLEntity& entity)
+{
+  if (!OutputGenerator::needsLayout(format))
+    return Layout();
+  return LayoutEngine::compute(entity,
+                               OutputGenerator::needsGridLayout(format));
+}
+
+// Render the entity in the given format into os
+void
+OutputGenerator::render(FORMAT format,
+                        const VHDLEntity& entity,
+                        std::ostream& os)
+{
+  render(format, entity, computeLayout(format, entity), os);
+}
+
+// Render the entity in the given format with a precomputed layout into os
+void
+OutputGenerator::render(FORMAT format,
+                        const VHDLEntity& entity,
+                        const Layout& layout,
+                        std::ostream& os)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "OutputGenerator::render()";
+
+  switch (format) {
+    case FORMAT::FODG: {
+      // Pass the source entity to the FODGTranslator
+      FODG mFODG(entity, layout, os);
+      break;
+    }
+    case FORMAT::SVG: {
+      SVG mSVG(entity, layout, os);
+      break;
+    }
+    case FORMAT::PNG: {
+      // Draw the SVG geometry into a bitmap
+      PNGWriter mWriter(os);
+      SVG mSVG(entity, layout, os, mWriter);
+      break;
+    }
+    case FORMAT::DokuWiki: {
+      DWMarkup mDWMarkup(entity, os);
+      break;
+    }
+    case FORMAT::Markdown: {
+      Markdown mMarkdown(entity, os);
+      break;
+    }
+    case FORMAT::LaTeX: {
+      LaTeX mLaTeX(entity, os);
+      break;
+    }
+  }
+}
+
+// Stream buffer which appends to a std::string. Other than
+// std::ostringstream the rendered output isn't copied once it's complete
+class StringStreamBuffer : public std::streambuf
+{
+public:
+  explicit StringStreamBuffer(std::string& str)
+    : mStr(str)
+  {}
+
+protected:
+  int_type overflow(int_type c) override
+  {
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+      mStr.push_back(traits_type::to_char_type(c));
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char* s, std::streamsize n) override
+  {
+    mStr.append(s, (size_t)n);
+    return n;
+  }
+
+private:
+  std::string& mStr;
+};
+
+// Render the entity in the given format into a string
+std::string
+OutputGenerator::render(FORMAT format, const VHDLEntity& entity)
+{
+  return render(format, entity, computeLayout(format, entity));
+}
+
+// Render the entity in the given format with a precomputed layout into a
+// string
 std::string
-OutputGenerator::getOutputPath(std::string filePath)
+OutputGenerator::render(FORMAT format,
+                        const VHDLEntity& entity,
+                        const Layout& layout)
+{
+  // Large enough for most entities, so the buffer rarely has to grow
+  std::string output;
+  output.reserve(64 * 1024);
+
+  StringStreamBuffer buffer(output);
+  std::ostream os(&buffer);
+  render(format, entity, layout, os);
+
+  return output;
+}
+
+// FODG shapes are aligned to a 0.5cm grid, so LibreOffice can glue connectors
+// to them
+bool
+OutputGenerator::needsGridLayout(FORMAT format)
+{
+  return format == FORMAT::FODG;
+}
+
+// Only drawings use the layout
+bool
+OutputGenerator::needsLayout(FORMAT format)
+{
+  return (format == FORMAT::FODG) || (format == FORMAT::SVG) ||
+         (format == FORMAT::PNG);
+}
+
+// Compute the layout of the source entity on first use
+const Layout&
+OutputGenerator::getLayout(FORMAT format)
+{
+  std::optional<Layout>& layout =
+    needsGridLayout(format) ? mGridLayout : mLayout;
+
+  if (!layout) {
+    Stats::Timer timer(Stats::PHASE::LAYOUT);
+    layout = LayoutEngine::compute(mSourceEntity, needsGridLayout(format));
+  }
+
+  return *layout;
+}
+
+// Render the source entity and write it to the output file of the format
+void
+OutputGenerator::writeOutputFile(FORMAT format)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "OutputGenerator::getOutputPath(std::string filePath)";
+    << "OutputGenerator::writeOutputFile()";
+
+  const ConfigSnapshot& settings = cfg.getSnapshot();
+  std::string filePath;
+  Stats::PHASE phase = Stats::PHASE::FODG;
+
+  switch (format) {
+    case FORMAT::FODG:
+      filePath = OFileHandler::getOutputFilePath(
+        settings.fodgExport.outputPath, mSourceName, "fodg");
+      break;
+    case FORMAT::SVG:
+      filePath = OFileHandler::getOutputFilePath(
+        settings.svgExport.outputPath, mSourceName, "svg");
+      phase = Stats::PHASE::SVG;
+      break;
+    case FORMAT::PNG:
+      filePath = OFileHandler::getOutputFilePath(
+        settings.pngExport.outputPath, mSourceName, "png");
+      phase = Stats::PHASE::PNG;
+      break;
+    case FORMAT::DokuWiki:
+      filePath = OFileHandler::getOutputFilePath(
+        settings.dokuWikiExport.outputPath, mSourceName, "txt", "markup");
+      phase = Stats::PHASE::DOKUWIKI;
+      break;
+    case FORMAT::Markdown:
+      filePath = OFileHandler::getOutputFilePath(
+        settings.markdownExport.outputPath, mSourceName, "md", "markdown");
+      phase = Stats::PHASE::MARKDOWN;
+      break;
+    case FORMAT::LaTeX:
+      filePath = OFileHandler::getOutputFilePath(
+        settings.laTeXExport.outputPath, mSourceName, "tex");
+      phase = Stats::PHASE::LATEX;
+      break;
+  }
+
+  // The layout is measured on its own. Tables don't use it
+  static const Layout noLayout = Layout();
+  const Layout& layout = needsLayout(format) ? getLayout(format) : noLayout;
+  Stats::Timer timer(phase);
 
-  int lastSlash = filePath.find_last_of('\\');
-  if (lastSlash == -1)
-    return "";
+  // Render into memory first, so each file is written with a single call
+  if (OFileHandler::writeFile(filePath,
+                              render(format, mSourceEntity, layout),
+                              settings.fsync,
+                              format == FORMAT::PNG))
+    mOutputFiles.push_back(filePath);
   else
-    return filePath.substr(0, lastSlash + 1);
+    mFailed = true;
 }
@@ -31,12 +31,62 @@
 
 #ifndef OUTPUTGENERATOR_H
 #define OUTPUTGENERATOR_H
+#include "LayoutEngine.h"
 #include "VHDLEntity.h"
 
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
 class OutputGenerator
 {
 public:
-  OutputGenerator(std::string sourcePath, VHDLEntity sourceEntity);
+  // Output formats which can be rendered from a VHDLEntity
+  enum class FORMAT
+  {
+    FODG,
+    SVG,
+    PNG,
+    DokuWiki,
+    Markdown,
+    LaTeX
+  };
+
+  // Renders the entity in the given format into os. Nothing is written to
+  // disk, so this may be called from any thread once the config is resolved
+  static void render(FORMAT format,
+                     const VHDLEntity& entity,
+                     std::ostream& os);
+
+  // Renders the entity with a precomputed layout. The layout has to be grid
+  // aligned for FODG (see needsGridLayout())
+  static void render(FORMAT format,
+                     const VHDLEntity& entity,
+                     const Layout& layout,
+                     std::ostream& os);
+
+  // Renders the entity in the given format and returns the result
+  static std::string render(FORMAT format, const VHDLEntity& entity);
+  static std::string render(FORMAT format,
+                            const VHDLEntity& entity,
+                            const Layout& layout);
+
+  // Returns true if the format is drawn with a grid aligned layout
+  static bool needsGridLayout(FORMAT format);
+
+  // Returns true if the format is a drawing. Tables don't use the layout, so
+  // it may be empty for them
+  static bool needsLayout(FORMAT format);
+
+  // The entity isn't copied and has to outlive the OutputGenerator
+  OutputGenerator(std::string sourcePath, const VHDLEntity& sourceEntity);
+
+  // Returns the paths of the created output files
+  const std::vector<std::string>& getOutputFiles() const;
+
+  // Returns true if an output file couldn't be created
+  bool hasFailed() const;
 
 private:
   void generateFODG();           // Generate FODG file
@@ -46,12 +96,22 @@ private:
   void generateMarkdown();       // Generate Makrdown table
   void generateLaTeX();          // Generate LaTeX table
 
-  std::string getOutputPath(
-    std::string filePath); // Helper function to get path from source file
+  // Renders the source entity and writes it to its output file
+  void writeOutputFile(FORMAT format);
 
-  VHDLEntity mSourceEntity;
+  // Returns the layout of the source entity for the format. Each layout is
+  // only computed once and shared by all formats using it
+  const Layout& getLayout(FORMAT format);
+
+  const VHDLEntity& mSourceEntity;
   std::string mSourceName;
   std::string mSourcePath;
+
+  std::optional<Layout> mLayout;
+  std::optional<Layout> mGridLayout;
+
+  std::vector<std::string> mOutputFiles;
+  bool mFailed;
 };
 
 #endif
\ No newline at end of file
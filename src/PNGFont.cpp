@@ -0,0 +1,618 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: PNGFont.cpp
+*	Author: Benjamin Wießneth
+*	Description: Vector font for the PNG rasterizer
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "PNGFont.h"
+
+// Shorthand for the end of a contour in the point table
+#define END PNGFont::contourEnd
+
+// Glyph outlines of DejaVu Sans for the printable ASCII characters. Curves
+// are flattened to line segments. DejaVu fonts are derived from Bitstream
+// Vera, Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved.
+// See https://dejavu-fonts.github.io/License.html
+const PNGFont::Glyph PNGFont::glyphs[] = {
+  { 81, 0, 0 }, // ' '
+  { 103, 0, 12 }, // '!'
+  { 118, 12, 10 }, // '"'
+  { 215, 22, 34 }, // '#'
+  { 163, 56, 96 }, // '$'
+  { 243, 152, 137 }, // '%'
+  { 200, 289, 95 }, // '&'
+  { 70, 384, 5 }, // '\''
+  { 100, 389, 31 }, // '('
+  { 100, 420, 31 }, // ')'
+  { 128, 451, 19 }, // '*'
+  { 215, 470, 13 }, // '+'
+  { 81, 483, 7 }, // ','
+  { 92, 490, 5 }, // '-'
+  { 81, 495, 5 }, // '.'
+  { 86, 500, 5 }, // '/'
+  { 163, 505, 90 }, // '0'
+  { 163, 595, 12 }, // '1'
+  { 163, 607, 66 }, // '2'
+  { 163, 673, 90 }, // '3'
+  { 163, 763, 16 }, // '4'
+  { 163, 779, 57 }, // '5'
+  { 163, 836, 103 }, // '6'
+  { 163, 939, 8 }, // '7'
+  { 163, 947, 139 }, // '8'
+  { 163, 1086, 103 }, // '9'
+  { 86, 1189, 10 }, // ':'
+  { 86, 1199, 12 }, // ';'
+  { 215, 1211, 8 }, // '<'
+  { 215, 1219, 10 }, // '='
+  { 215, 1229, 8 }, // '>'
+  { 136, 1237, 64 }, // '?'
+  { 256, 1301, 181 }, // '@'
+  { 175, 1482, 13 }, // 'A'
+  { 176, 1495, 80 }, // 'B'
+  { 179, 1575, 71 }, // 'C'
+  { 197, 1646, 59 }, // 'D'
+  { 162, 1705, 13 }, // 'E'
+  { 147, 1718, 11 }, // 'F'
+  { 198, 1729, 77 }, // 'G'
+  { 193, 1806, 13 }, // 'H'
+  { 76, 1819, 5 }, // 'I'
+  { 76, 1824, 26 }, // 'J'
+  { 168, 1850, 12 }, // 'K'
+  { 143, 1862, 7 }, // 'L'
+  { 221, 1869, 14 }, // 'M'
+  { 192, 1883, 11 }, // 'N'
+  { 202, 1894, 90 }, // 'O'
+  { 154, 1984, 46 }, // 'P'
+  { 202, 2030, 94 }, // 'Q'
+  { 178, 2124, 60 }, // 'R'
+  { 163, 2184, 94 }, // 'S'
+  { 156, 2278, 9 }, // 'T'
+  { 187, 2287, 51 }, // 'U'
+  { 175, 2338, 8 }, // 'V'
+  { 253, 2346, 14 }, // 'W'
+  { 175, 2360, 13 }, // 'X'
+  { 156, 2373, 10 }, // 'Y'
+  { 175, 2383, 11 }, // 'Z'
+  { 100, 2394, 9 }, // '['
+  { 86, 2403, 5 }, // '\\'
+  { 100, 2408, 9 }, // ']'
+  { 215, 2417, 8 }, // '^'
+  { 128, 2425, 5 }, // '_'
+  { 128, 2430, 5 }, // '`'
+  { 157, 2435, 85 }, // 'a'
+  { 163, 2520, 75 }, // 'b'
+  { 141, 2595, 59 }, // 'c'
+  { 163, 2654, 75 }, // 'd'
+  { 158, 2729, 68 }, // 'e'
+  { 90, 2797, 33 }, // 'f'
+  { 163, 2830, 101 }, // 'g'
+  { 162, 2931, 41 }, // 'h'
+  { 71, 2972, 10 }, // 'i'
+  { 71, 2982, 30 }, // 'j'
+  { 148, 3012, 12 }, // 'k'
+  { 71, 3024, 5 }, // 'l'
+  { 249, 3029, 73 }, // 'm'
+  { 162, 3102, 41 }, // 'n'
+  { 157, 3143, 78 }, // 'o'
+  { 163, 3221, 75 }, // 'p'
+  { 163, 3296, 75 }, // 'q'
+  { 105, 3371, 27 }, // 'r'
+  { 133, 3398, 86 }, // 's'
+  { 100, 3484, 33 }, // 't'
+  { 162, 3517, 43 }, // 'u'
+  { 152, 3560, 8 }, // 'v'
+  { 209, 3568, 14 }, // 'w'
+  { 152, 3582, 13 }, // 'x'
+  { 152, 3595, 27 }, // 'y'
+  { 134, 3622, 11 }, // 'z'
+  { 163, 3633, 82 }, // '{'
+  { 86, 3715, 5 }, // '|'
+  { 163, 3720, 82 }, // '}'
+  { 215, 3802, 46 }, // '~'
+};
+
+// Coordinate pairs of all glyphs
+const short PNGFont::points[] = {
+  39, 32, 64, 32, 64, 0, 39, 0, END, 0, 39, 187, 64, 187, 64, 105, 62, 60,
+  41, 60, 39, 105, END, 0, 46, 187, 46, 117, 25, 117, 25, 187, END, 0, 93, 187,
+  93, 117, 72, 117, 72, 187, END, 0, 131, 113, 95, 113, 84, 71, 121, 71,
+  END, 0, 112, 184, 99, 132, 136, 132, 149, 184, 169, 184, 156, 132, 195, 132,
+  195, 113, 151, 113, 141, 71, 181, 71, 181, 52, 136, 52, 123, 0, 103, 0,
+  116, 52, 79, 52, 66, 0, 46, 0, 59, 52, 20, 52, 20, 71, 64, 71, 74, 113,
+  34, 113, 34, 132, 79, 132, 92, 184, END, 0, 87, -38, 74, -38, 74, 0, 61, 1,
+  48, 3, 34, 7, 21, 12, 21, 34, 34, 27, 47, 22, 60, 19, 74, 18, 74, 75, 64, 77,
+  54, 79, 46, 82, 39, 86, 34, 90, 28, 96, 24, 103, 22, 111, 21, 120, 22, 127,
+  23, 134, 26, 141, 30, 147, 35, 152, 42, 157, 51, 161, 62, 164, 74, 165,
+  74, 195, 87, 195, 87, 166, 98, 165, 109, 163, 120, 161, 130, 158, 130, 136,
+  120, 141, 109, 144, 98, 146, 87, 147, 87, 94, 97, 92, 107, 89, 115, 86,
+  122, 83, 128, 78, 134, 72, 138, 65, 141, 57, 142, 48, 141, 40, 139, 32,
+  136, 25, 133, 20, 127, 14, 121, 10, 114, 6, 106, 3, 97, 1, 87, 0, END, 0,
+  74, 96, 74, 148, 65, 146, 58, 143, 52, 139, 48, 134, 45, 128, 44, 122,
+  45, 115, 47, 109, 51, 105, 55, 102, 61, 100, 67, 98, END, 0, 87, 72, 87, 18,
+  94, 19, 100, 21, 106, 24, 110, 27, 114, 31, 116, 35, 118, 40, 119, 45,
+  118, 52, 115, 58, 111, 63, 106, 66, 101, 68, 94, 71, END, 0, 186, 82,
+  181, 82, 176, 80, 172, 77, 169, 73, 166, 68, 164, 62, 163, 55, 163, 47,
+  163, 39, 164, 33, 166, 27, 169, 22, 172, 17, 176, 15, 181, 13, 186, 12,
+  191, 13, 196, 15, 200, 17, 203, 22, 206, 27, 208, 33, 209, 39, 209, 47,
+  209, 55, 208, 62, 206, 68, 203, 73, 200, 77, 196, 80, 191, 82, END, 0,
+  186, 98, 195, 97, 204, 95, 211, 90, 218, 84, 223, 77, 226, 68, 228, 58,
+  229, 47, 228, 36, 226, 26, 223, 17, 217, 10, 211, 4, 204, 0, 195, -3,
+  186, -4, 177, -3, 168, 0, 161, 4, 155, 10, 149, 17, 146, 26, 144, 36,
+  143, 47, 144, 58, 146, 68, 149, 77, 155, 84, 161, 90, 168, 95, 177, 97,
+  END, 0, 57, 174, 52, 174, 48, 172, 44, 169, 40, 165, 37, 160, 36, 154,
+  34, 147, 34, 139, 34, 131, 36, 125, 37, 119, 40, 114, 43, 109, 47, 107,
+  52, 105, 57, 104, 62, 105, 67, 107, 71, 109, 74, 114, 77, 119, 79, 125,
+  80, 131, 80, 139, 80, 147, 79, 154, 77, 160, 74, 165, 71, 169, 67, 172,
+  62, 174, END, 0, 170, 190, 190, 190, 73, -4, 53, -4, END, 0, 57, 190,
+  67, 189, 75, 187, 82, 182, 89, 176, 94, 169, 97, 160, 100, 150, 100, 139,
+  100, 128, 97, 118, 94, 109, 89, 102, 82, 96, 75, 92, 67, 89, 57, 88, 48, 89,
+  39, 92, 32, 96, 26, 102, 21, 109, 17, 118, 15, 128, 14, 139, 15, 150,
+  17, 160, 21, 169, 26, 176, 32, 182, 39, 187, 48, 189, END, 0, 62, 100,
+  55, 94, 50, 87, 46, 80, 43, 73, 41, 66, 40, 59, 41, 50, 44, 42, 48, 35,
+  54, 29, 61, 23, 68, 20, 77, 17, 87, 17, 95, 17, 102, 18, 109, 21, 116, 24,
+  122, 28, 129, 33, END, 0, 80, 114, 143, 49, 150, 61, 155, 73, 158, 86,
+  160, 100, 183, 100, 181, 89, 179, 78, 175, 68, 170, 57, 164, 46, 157, 36,
+  192, 0, 160, 0, 142, 18, 134, 12, 124, 6, 115, 2, 105, -1, 95, -3, 85, -4,
+  73, -3, 62, -1, 52, 3, 43, 7, 35, 14, 28, 21, 23, 29, 19, 38, 17, 47, 16, 58,
+  17, 68, 20, 78, 25, 88, 31, 97, 39, 106, 50, 114, 44, 122, 41, 130, 38, 138,
+  37, 145, 38, 153, 40, 160, 42, 167, 46, 172, 51, 178, 59, 183, 67, 187,
+  77, 189, 88, 190, 98, 189, 109, 188, 119, 185, 130, 181, 130, 158, 119, 163,
+  109, 167, 99, 169, 91, 170, 82, 169, 75, 167, 69, 163, 66, 160, 63, 155,
+  62, 151, 61, 145, 62, 139, 65, 133, 67, 129, 70, 125, 75, 120, END, 0,
+  46, 187, 46, 117, 25, 117, 25, 187, END, 0, 79, 194, 69, 175, 61, 156,
+  55, 137, 50, 119, 47, 100, 46, 80, 47, 61, 50, 42, 55, 23, 61, 4, 69, -15,
+  79, -34, 59, -34, 51, -19, 43, -5, 37, 10, 31, 24, 27, 38, 24, 52, 23, 66,
+  22, 80, 23, 94, 24, 108, 27, 122, 31, 137, 36, 151, 43, 165, 51, 180,
+  59, 194, END, 0, 21, 194, 41, 194, 49, 180, 57, 165, 63, 151, 69, 137,
+  73, 122, 76, 108, 77, 94, 78, 80, 77, 66, 76, 52, 73, 38, 69, 24, 63, 10,
+  57, -5, 49, -19, 41, -34, 21, -34, 31, -15, 39, 4, 45, 23, 50, 42, 53, 61,
+  54, 80, 53, 100, 50, 119, 45, 137, 39, 156, 31, 175, END, 0, 120, 156,
+  76, 132, 120, 107, 113, 95, 71, 120, 71, 73, 57, 73, 57, 120, 15, 95, 8, 107,
+  53, 132, 8, 156, 15, 168, 57, 143, 57, 190, 71, 190, 71, 143, 113, 168,
+  END, 0, 118, 161, 118, 91, 187, 91, 187, 70, 118, 70, 118, 0, 97, 0, 97, 70,
+  27, 70, 27, 91, 97, 91, 97, 161, END, 0, 30, 32, 56, 32, 56, 10, 36, -30,
+  20, -30, 30, 10, END, 0, 13, 80, 80, 80, 80, 60, 13, 60, END, 0, 27, 32,
+  54, 32, 54, 0, 27, 0, END, 0, 65, 187, 86, 187, 21, -24, 0, -24, END, 0,
+  81, 170, 74, 169, 67, 167, 61, 163, 56, 158, 52, 151, 48, 142, 46, 132,
+  44, 121, 43, 108, 42, 93, 43, 79, 44, 65, 46, 54, 48, 44, 52, 36, 56, 29,
+  61, 23, 67, 19, 74, 17, 81, 16, 89, 17, 95, 19, 101, 23, 106, 29, 111, 36,
+  114, 44, 117, 54, 119, 65, 120, 79, 121, 93, 120, 108, 119, 121, 117, 132,
+  114, 142, 111, 151, 106, 158, 101, 163, 95, 167, 89, 169, END, 0, 81, 190,
+  91, 189, 101, 187, 109, 184, 117, 179, 123, 173, 129, 165, 134, 156,
+  138, 146, 142, 135, 144, 122, 145, 108, 146, 93, 145, 78, 144, 64, 142, 52,
+  138, 40, 134, 30, 129, 21, 123, 14, 117, 7, 109, 3, 101, -1, 91, -3, 81, -4,
+  71, -3, 62, -1, 54, 3, 46, 7, 39, 14, 33, 21, 28, 30, 24, 40, 21, 52, 19, 64,
+  17, 78, 17, 93, 17, 108, 19, 122, 21, 135, 24, 146, 28, 156, 33, 165,
+  39, 173, 46, 179, 54, 184, 62, 187, 71, 189, END, 0, 32, 21, 73, 21, 73, 164,
+  28, 155, 28, 178, 73, 187, 98, 187, 98, 21, 139, 21, 139, 0, 32, 0, END, 0,
+  49, 21, 137, 21, 137, 0, 19, 0, 19, 21, 27, 29, 36, 39, 46, 49, 58, 61,
+  66, 69, 72, 76, 78, 82, 83, 87, 86, 91, 89, 94, 96, 102, 102, 110, 106, 117,
+  109, 123, 110, 129, 111, 135, 110, 142, 108, 149, 105, 154, 100, 159,
+  95, 163, 88, 166, 81, 168, 73, 169, 65, 168, 57, 167, 48, 165, 39, 161,
+  30, 157, 20, 152, 20, 178, 35, 183, 49, 187, 61, 189, 73, 190, 84, 189,
+  94, 188, 103, 185, 112, 181, 119, 176, 125, 169, 130, 162, 133, 155,
+  136, 146, 136, 137, 136, 129, 134, 122, 132, 115, 128, 108, 123, 100,
+  116, 91, 114, 89, 112, 86, 108, 81, 103, 76, 96, 70, 89, 62, 81, 54, 71, 44,
+  61, 33, END, 0, 104, 101, 112, 98, 120, 95, 127, 90, 132, 85, 137, 78,
+  140, 71, 142, 63, 142, 54, 142, 44, 139, 34, 136, 26, 130, 18, 123, 12,
+  115, 6, 106, 2, 95, -1, 83, -3, 69, -4, 57, -3, 45, -1, 33, 2, 20, 6, 20, 30,
+  31, 25, 43, 21, 55, 18, 69, 18, 80, 18, 90, 20, 98, 23, 105, 27, 110, 32,
+  114, 39, 116, 46, 117, 54, 117, 62, 114, 69, 111, 75, 106, 80, 99, 84,
+  92, 87, 83, 89, 74, 89, 52, 89, 52, 110, 75, 110, 83, 111, 91, 112, 98, 114,
+  103, 118, 107, 122, 110, 127, 112, 132, 113, 139, 112, 146, 110, 152,
+  107, 157, 103, 161, 97, 164, 90, 167, 82, 168, 74, 169, 63, 168, 51, 167,
+  39, 164, 25, 160, 25, 182, 39, 186, 52, 188, 64, 190, 76, 190, 87, 189,
+  97, 188, 106, 185, 114, 182, 121, 177, 127, 171, 132, 165, 135, 158,
+  137, 150, 138, 142, 137, 134, 136, 127, 133, 121, 129, 115, 124, 110,
+  118, 106, 112, 103, END, 0, 97, 165, 33, 65, 97, 65, END, 0, 90, 187,
+  122, 187, 122, 65, 149, 65, 149, 44, 122, 44, 122, 0, 97, 0, 97, 44, 13, 44,
+  13, 68, END, 0, 28, 187, 127, 187, 127, 165, 51, 165, 51, 120, 62, 122,
+  73, 123, 85, 123, 96, 121, 106, 117, 114, 112, 122, 106, 129, 99, 134, 91,
+  138, 81, 140, 71, 141, 60, 140, 48, 138, 38, 134, 29, 129, 20, 122, 13,
+  114, 7, 104, 2, 94, -1, 82, -3, 69, -4, 57, -3, 45, -2, 33, 1, 20, 4, 20, 30,
+  31, 24, 43, 21, 55, 18, 68, 18, 79, 18, 88, 20, 96, 24, 103, 29, 108, 35,
+  112, 42, 114, 51, 115, 60, 114, 69, 112, 77, 108, 85, 103, 91, 96, 96,
+  88, 99, 79, 101, 68, 102, 58, 102, 48, 100, 38, 97, 28, 93, END, 0, 85, 103,
+  76, 103, 69, 100, 63, 97, 58, 92, 53, 85, 50, 78, 48, 69, 48, 60, 48, 50,
+  50, 42, 53, 34, 58, 28, 63, 23, 69, 19, 76, 17, 85, 16, 93, 17, 100, 19,
+  106, 23, 111, 28, 116, 34, 119, 42, 121, 50, 121, 60, 121, 69, 119, 78,
+  116, 85, 111, 92, 106, 97, 100, 100, 93, 103, END, 0, 135, 183, 135, 160,
+  125, 163, 115, 166, 106, 168, 96, 169, 87, 168, 78, 166, 70, 163, 64, 158,
+  58, 152, 53, 144, 49, 136, 46, 125, 44, 114, 43, 101, 48, 108, 55, 113,
+  62, 118, 69, 121, 77, 123, 86, 123, 97, 123, 107, 121, 115, 117, 123, 112,
+  130, 106, 136, 99, 141, 91, 144, 81, 146, 71, 147, 60, 146, 49, 144, 39,
+  141, 29, 136, 21, 130, 14, 123, 7, 114, 3, 105, -1, 95, -3, 85, -4, 74, -3,
+  65, -1, 56, 3, 48, 7, 41, 14, 35, 21, 30, 30, 25, 40, 22, 52, 20, 64, 18, 78,
+  18, 93, 18, 107, 20, 121, 23, 133, 27, 144, 32, 154, 39, 164, 46, 172,
+  54, 178, 63, 183, 73, 187, 84, 189, 95, 190, 105, 190, 114, 188, 124, 186,
+  END, 0, 21, 187, 141, 187, 141, 176, 73, 0, 47, 0, 111, 165, 21, 165, END, 0,
+  81, 89, 73, 88, 65, 86, 59, 83, 53, 79, 49, 74, 45, 68, 43, 60, 43, 53,
+  43, 45, 45, 37, 49, 31, 53, 26, 59, 22, 65, 19, 73, 17, 81, 16, 90, 17,
+  97, 19, 104, 22, 110, 26, 114, 31, 118, 38, 119, 45, 120, 53, 119, 60,
+  118, 68, 114, 74, 110, 79, 104, 83, 98, 86, 90, 88, END, 0, 56, 99, 48, 102,
+  42, 105, 36, 109, 31, 115, 27, 120, 24, 127, 22, 134, 22, 142, 22, 150,
+  24, 158, 27, 165, 32, 171, 38, 177, 44, 182, 52, 185, 61, 188, 71, 189,
+  81, 190, 92, 189, 102, 188, 111, 185, 118, 182, 125, 177, 131, 171, 135, 165,
+  138, 158, 140, 150, 141, 142, 140, 134, 139, 127, 136, 120, 132, 115,
+  127, 109, 121, 105, 114, 102, 107, 99, 115, 97, 123, 93, 130, 88, 135, 83,
+  140, 76, 143, 69, 145, 61, 145, 53, 145, 42, 143, 33, 139, 24, 135, 17,
+  129, 11, 122, 6, 113, 2, 104, -1, 93, -3, 81, -4, 70, -3, 59, -1, 49, 2,
+  41, 6, 34, 11, 28, 17, 23, 24, 20, 33, 18, 42, 17, 53, 18, 61, 20, 69,
+  23, 76, 28, 83, 33, 88, 40, 93, 48, 97, END, 0, 47, 139, 47, 132, 49, 126,
+  52, 121, 56, 117, 61, 113, 67, 111, 74, 109, 81, 109, 89, 109, 96, 111,
+  102, 113, 107, 117, 111, 121, 114, 126, 115, 132, 116, 139, 115, 146,
+  114, 152, 111, 157, 107, 162, 102, 165, 96, 168, 89, 169, 81, 170, 74, 169,
+  67, 168, 61, 165, 56, 162, 52, 157, 49, 152, 47, 146, END, 0, 28, 4, 28, 27,
+  38, 23, 47, 20, 57, 18, 67, 18, 76, 18, 85, 20, 92, 24, 99, 28, 105, 34,
+  109, 42, 113, 51, 116, 61, 119, 72, 120, 86, 114, 79, 108, 73, 101, 69,
+  94, 66, 85, 64, 77, 63, 66, 64, 56, 66, 47, 69, 39, 74, 32, 80, 27, 87,
+  22, 96, 19, 105, 17, 115, 16, 127, 17, 138, 19, 148, 22, 157, 27, 165,
+  33, 173, 40, 179, 49, 184, 58, 187, 68, 189, 78, 190, 89, 189, 98, 187,
+  107, 184, 115, 179, 122, 173, 128, 165, 133, 156, 137, 146, 141, 135,
+  143, 122, 144, 108, 145, 93, 144, 79, 143, 66, 140, 53, 136, 42, 130, 32,
+  124, 23, 117, 15, 108, 8, 99, 3, 90, -1, 79, -3, 68, -4, 58, -3, 48, -2,
+  38, 1, END, 0, 78, 83, 86, 84, 94, 86, 100, 90, 105, 95, 110, 101, 113, 108,
+  115, 117, 115, 127, 115, 136, 113, 145, 110, 152, 105, 158, 100, 163,
+  94, 167, 86, 169, 78, 170, 70, 169, 63, 167, 57, 163, 51, 158, 47, 152,
+  44, 145, 42, 136, 42, 127, 42, 117, 44, 108, 47, 101, 51, 95, 57, 90, 63, 86,
+  70, 84, END, 0, 30, 32, 56, 32, 56, 0, 30, 0, END, 0, 30, 132, 56, 132,
+  56, 101, 30, 101, END, 0, 30, 132, 56, 132, 56, 101, 30, 101, END, 0, 30, 32,
+  56, 32, 56, 10, 36, -30, 20, -30, 30, 10, END, 0, 187, 126, 58, 80, 187, 35,
+  187, 12, 27, 70, 27, 91, 187, 149, END, 0, 27, 116, 187, 116, 187, 95,
+  27, 95, END, 0, 27, 65, 187, 65, 187, 44, 27, 44, END, 0, 27, 126, 27, 149,
+  187, 91, 187, 70, 27, 12, 27, 35, 156, 80, END, 0, 49, 32, 74, 32, 74, 0,
+  49, 0, END, 0, 74, 50, 50, 50, 50, 69, 50, 77, 51, 84, 53, 90, 56, 96,
+  61, 102, 68, 109, 79, 120, 83, 124, 87, 129, 89, 133, 92, 139, 93, 145,
+  92, 150, 91, 155, 88, 159, 84, 163, 78, 166, 71, 169, 63, 170, 56, 169,
+  49, 168, 42, 165, 34, 162, 26, 158, 18, 152, 18, 176, 30, 182, 42, 187,
+  54, 189, 67, 190, 78, 189, 88, 187, 96, 183, 104, 178, 109, 173, 113, 167,
+  116, 161, 117, 154, 118, 146, 118, 140, 116, 134, 114, 128, 110, 122,
+  105, 115, 98, 109, 87, 98, 83, 94, 80, 91, 78, 89, 76, 85, 75, 82, 74, 79,
+  74, 76, 74, 71, 74, 66, END, 0, 95, 67, 96, 59, 97, 51, 100, 45, 104, 39,
+  109, 35, 115, 31, 121, 30, 129, 29, 136, 30, 142, 31, 148, 35, 153, 39,
+  157, 45, 159, 51, 161, 59, 162, 67, 161, 75, 159, 83, 156, 89, 153, 95,
+  148, 99, 142, 103, 135, 105, 128, 105, 121, 105, 115, 103, 109, 99, 104, 95,
+  100, 89, 97, 83, 96, 75, END, 0, 163, 30, 158, 24, 152, 19, 146, 16, 139, 13,
+  132, 12, 124, 11, 115, 12, 108, 13, 101, 17, 94, 21, 89, 27, 84, 33, 80, 41,
+  77, 49, 76, 58, 75, 67, 76, 77, 77, 86, 80, 94, 84, 101, 89, 108, 94, 113,
+  101, 118, 108, 121, 115, 123, 124, 123, 132, 123, 139, 121, 146, 119,
+  152, 115, 158, 110, 163, 105, 163, 121, 181, 121, 181, 29, 190, 31, 198, 34,
+  204, 39, 210, 46, 214, 53, 218, 62, 219, 71, 220, 82, 220, 90, 218, 99,
+  216, 107, 213, 114, 209, 122, 204, 129, 197, 136, 190, 143, 182, 149,
+  173, 154, 163, 157, 153, 160, 143, 162, 132, 162, 122, 162, 112, 160,
+  102, 158, 93, 155, 84, 151, 76, 146, 67, 139, 59, 131, 52, 123, 46, 113,
+  41, 102, 37, 91, 35, 80, 35, 68, 35, 55, 38, 42, 42, 31, 47, 20, 54, 9,
+  63, 0, 72, -8, 82, -15, 93, -20, 105, -24, 117, -26, 130, -27, 140, -26,
+  151, -24, 161, -21, 172, -17, 181, -12, 190, -6, 201, -20, 191, -27,
+  179, -33, 167, -38, 155, -42, 142, -44, 130, -45, 115, -44, 100, -41,
+  86, -36, 73, -30, 61, -22, 50, -13, 42, -4, 36, 4, 30, 14, 25, 24, 21, 38,
+  18, 52, 17, 68, 18, 83, 21, 97, 25, 111, 32, 124, 40, 137, 50, 148, 58, 155,
+  67, 162, 77, 167, 87, 172, 101, 176, 116, 179, 132, 180, 145, 180, 157, 178,
+  169, 174, 181, 169, 192, 163, 202, 156, 211, 148, 219, 139, 225, 130,
+  229, 121, 233, 112, 236, 102, 238, 92, 238, 82, 237, 70, 235, 58, 231, 48,
+  225, 38, 218, 30, 210, 23, 200, 18, 189, 14, 177, 12, 163, 11, END, 0,
+  88, 162, 53, 69, 122, 69, END, 0, 73, 187, 102, 187, 173, 0, 147, 0, 130, 48,
+  46, 48, 29, 0, 2, 0, END, 0, 50, 89, 50, 21, 91, 21, 100, 21, 109, 23,
+  115, 25, 121, 29, 125, 34, 128, 40, 130, 47, 131, 55, 130, 63, 128, 70,
+  125, 76, 121, 81, 115, 84, 109, 87, 100, 89, 91, 89, END, 0, 50, 166,
+  50, 110, 88, 110, 96, 110, 104, 111, 110, 113, 115, 117, 119, 120, 122, 125,
+  124, 131, 124, 138, 124, 144, 122, 150, 119, 155, 115, 159, 110, 162,
+  104, 164, 96, 165, 88, 166, END, 0, 25, 187, 90, 187, 101, 186, 111, 185,
+  120, 182, 127, 179, 134, 175, 140, 169, 144, 163, 147, 157, 149, 149,
+  150, 141, 149, 132, 148, 125, 145, 119, 142, 113, 137, 109, 132, 105,
+  126, 102, 118, 101, 127, 98, 135, 94, 141, 90, 147, 84, 152, 77, 155, 70,
+  157, 61, 158, 52, 157, 43, 155, 34, 151, 26, 147, 20, 141, 14, 133, 9,
+  125, 5, 115, 2, 104, 1, 92, 0, 25, 0, END, 0, 165, 172, 165, 146, 156, 153,
+  147, 159, 138, 163, 128, 167, 118, 169, 107, 169, 95, 168, 84, 166, 74, 162,
+  65, 157, 58, 150, 52, 141, 47, 131, 44, 120, 42, 107, 41, 93, 42, 79, 44, 66,
+  47, 55, 52, 45, 58, 37, 65, 30, 74, 24, 84, 20, 95, 18, 107, 17, 118, 18,
+  128, 20, 138, 23, 147, 28, 156, 34, 165, 41, 165, 14, 156, 9, 146, 4, 137, 1,
+  127, -2, 116, -3, 106, -4, 92, -3, 79, -1, 68, 3, 57, 8, 47, 14, 39, 22,
+  31, 31, 25, 42, 20, 53, 17, 65, 15, 79, 14, 93, 15, 108, 17, 121, 20, 133,
+  25, 145, 31, 155, 39, 164, 47, 172, 57, 178, 68, 184, 79, 187, 92, 189,
+  106, 190, 116, 190, 127, 188, 137, 186, 147, 182, 156, 178, END, 0, 50, 166,
+  50, 21, 81, 21, 93, 21, 104, 23, 114, 25, 123, 29, 131, 33, 137, 38, 143, 45,
+  147, 52, 151, 61, 153, 71, 155, 81, 155, 94, 155, 105, 153, 116, 151, 126,
+  147, 135, 143, 142, 137, 148, 131, 154, 123, 158, 114, 162, 104, 164,
+  93, 165, 81, 166, END, 0, 25, 187, 77, 187, 92, 186, 106, 185, 118, 182,
+  130, 179, 140, 175, 149, 170, 157, 164, 164, 156, 171, 146, 176, 135,
+  179, 123, 181, 109, 182, 94, 181, 80, 180, 68, 177, 57, 174, 47, 169, 38,
+  163, 30, 157, 23, 149, 17, 140, 12, 129, 7, 118, 4, 106, 2, 92, 0, 77, 0,
+  25, 0, END, 0, 25, 187, 143, 187, 143, 165, 50, 165, 50, 110, 139, 110,
+  139, 89, 50, 89, 50, 21, 145, 21, 145, 0, 25, 0, END, 0, 25, 187, 132, 187,
+  132, 165, 50, 165, 50, 110, 124, 110, 124, 89, 50, 89, 50, 0, 25, 0, END, 0,
+  152, 27, 152, 77, 111, 77, 111, 98, 177, 98, 177, 17, 167, 11, 157, 6,
+  145, 2, 133, -1, 121, -3, 108, -4, 93, -3, 80, -1, 69, 3, 58, 8, 48, 14,
+  39, 22, 31, 31, 25, 41, 21, 53, 17, 65, 15, 78, 14, 93, 15, 108, 17, 121,
+  21, 134, 25, 145, 31, 155, 39, 164, 48, 172, 58, 179, 69, 184, 80, 187,
+  93, 189, 108, 190, 119, 190, 131, 188, 142, 186, 153, 182, 163, 178,
+  173, 172, 173, 145, 163, 153, 153, 159, 143, 163, 132, 167, 121, 169,
+  110, 169, 99, 169, 89, 167, 80, 164, 72, 161, 64, 156, 58, 150, 53, 143,
+  49, 135, 45, 126, 43, 116, 41, 105, 41, 93, 41, 81, 43, 70, 45, 60, 49, 51,
+  53, 43, 58, 36, 64, 30, 72, 26, 80, 22, 89, 19, 99, 18, 110, 17, 122, 18,
+  134, 19, 143, 22, END, 0, 25, 187, 50, 187, 50, 110, 142, 110, 142, 187,
+  167, 187, 167, 0, 142, 0, 142, 89, 50, 89, 50, 0, 25, 0, END, 0, 25, 187,
+  50, 187, 50, 0, 25, 0, END, 0, 25, 187, 50, 187, 50, 13, 50, 0, 48, -11,
+  46, -21, 42, -29, 38, -36, 32, -41, 25, -46, 17, -49, 7, -51, -4, -51,
+  -13, -51, -13, -30, -5, -30, 2, -29, 9, -28, 14, -25, 18, -21, 21, -16,
+  23, -11, 24, -4, 25, 4, 25, 13, END, 0, 25, 187, 50, 187, 50, 108, 134, 187,
+  167, 187, 74, 100, 173, 0, 140, 0, 50, 90, 50, 0, 25, 0, END, 0, 25, 187,
+  50, 187, 50, 21, 141, 21, 141, 0, 25, 0, END, 0, 25, 187, 63, 187, 110, 60,
+  158, 187, 196, 187, 196, 0, 171, 0, 171, 164, 123, 36, 98, 36, 50, 164,
+  50, 0, 25, 0, END, 0, 25, 187, 59, 187, 142, 31, 142, 187, 166, 187, 166, 0,
+  132, 0, 50, 156, 50, 0, 25, 0, END, 0, 101, 170, 90, 169, 81, 166, 72, 162,
+  64, 156, 57, 149, 51, 140, 47, 130, 44, 119, 42, 107, 41, 93, 42, 80, 44, 67,
+  47, 56, 51, 46, 57, 37, 64, 30, 72, 24, 81, 20, 90, 18, 101, 17, 111, 18,
+  121, 20, 130, 24, 138, 30, 144, 37, 150, 46, 155, 56, 158, 67, 160, 80,
+  161, 93, 160, 107, 158, 119, 155, 130, 150, 140, 144, 149, 138, 156,
+  130, 162, 121, 166, 111, 169, END, 0, 101, 190, 114, 189, 125, 187, 136, 183,
+  146, 178, 155, 172, 164, 164, 171, 154, 177, 144, 181, 133, 185, 121,
+  186, 107, 187, 93, 186, 79, 185, 66, 181, 53, 177, 42, 171, 32, 164, 23,
+  155, 15, 146, 8, 136, 3, 125, -1, 114, -3, 101, -4, 88, -3, 76, -1, 65, 3,
+  55, 8, 46, 15, 38, 23, 31, 32, 25, 42, 20, 53, 17, 66, 15, 79, 14, 93,
+  15, 107, 17, 121, 20, 133, 25, 144, 31, 154, 38, 164, 46, 172, 55, 178,
+  65, 183, 76, 187, 88, 189, END, 0, 50, 166, 50, 96, 82, 96, 90, 96, 98, 98,
+  104, 101, 109, 105, 114, 110, 117, 116, 118, 123, 119, 131, 118, 139,
+  117, 146, 114, 152, 109, 157, 104, 161, 98, 164, 90, 165, 82, 166, END, 0,
+  25, 187, 82, 187, 94, 186, 105, 184, 114, 181, 122, 178, 130, 172, 135, 166,
+  140, 159, 143, 151, 145, 141, 146, 131, 145, 120, 143, 111, 140, 103,
+  135, 95, 130, 89, 122, 84, 114, 80, 105, 77, 94, 76, 82, 75, 50, 75, 50, 0,
+  25, 0, END, 0, 101, 170, 90, 169, 81, 166, 72, 162, 64, 156, 57, 149,
+  51, 140, 47, 130, 44, 119, 42, 107, 41, 93, 42, 80, 44, 67, 47, 56, 51, 46,
+  57, 37, 64, 30, 72, 24, 81, 20, 90, 18, 101, 17, 111, 18, 121, 20, 130, 24,
+  138, 30, 144, 37, 150, 46, 155, 56, 158, 67, 160, 80, 161, 93, 160, 107,
+  158, 119, 155, 130, 150, 140, 144, 149, 138, 156, 130, 162, 121, 166,
+  111, 169, END, 0, 136, 3, 170, -33, 139, -33, 111, -3, 108, -3, 105, -4,
+  101, -4, 88, -3, 76, -1, 65, 3, 55, 8, 46, 15, 38, 23, 31, 32, 25, 42,
+  20, 53, 17, 66, 15, 79, 14, 93, 15, 107, 17, 121, 20, 133, 25, 144, 31, 154,
+  38, 164, 46, 172, 55, 178, 65, 183, 76, 187, 88, 189, 101, 190, 114, 189,
+  125, 187, 136, 183, 146, 178, 155, 172, 164, 164, 171, 154, 177, 144,
+  181, 133, 185, 121, 186, 107, 187, 93, 187, 81, 185, 69, 182, 58, 179, 47,
+  174, 38, 168, 29, 162, 21, 154, 14, 146, 8, END, 0, 114, 88, 119, 85,
+  124, 81, 129, 76, 135, 69, 140, 61, 145, 51, 171, 0, 143, 0, 120, 48,
+  115, 56, 110, 63, 106, 69, 102, 73, 95, 76, 87, 78, 78, 79, 50, 79, 50, 0,
+  25, 0, 25, 187, 82, 187, 94, 186, 105, 184, 115, 182, 123, 178, 130, 173,
+  136, 167, 140, 160, 143, 152, 145, 143, 146, 133, 145, 124, 144, 117,
+  141, 110, 137, 104, 133, 98, 127, 94, 121, 90, END, 0, 50, 166, 50, 100,
+  82, 100, 91, 100, 98, 102, 104, 104, 110, 108, 114, 113, 117, 118, 118, 125,
+  119, 133, 118, 141, 117, 147, 114, 153, 110, 158, 104, 161, 98, 164, 91, 165,
+  82, 166, END, 0, 137, 181, 137, 156, 123, 162, 110, 166, 97, 169, 85, 170,
+  76, 169, 67, 168, 60, 165, 53, 162, 49, 157, 45, 152, 43, 146, 42, 139,
+  43, 133, 44, 128, 46, 124, 50, 120, 54, 117, 60, 114, 68, 112, 78, 110,
+  93, 107, 104, 104, 113, 101, 122, 97, 129, 93, 135, 88, 140, 82, 143, 75,
+  146, 68, 148, 60, 148, 52, 148, 41, 145, 32, 142, 24, 137, 17, 130, 10,
+  122, 5, 113, 1, 102, -1, 90, -3, 77, -4, 63, -3, 49, -1, 33, 3, 18, 8,
+  18, 34, 28, 29, 38, 25, 48, 21, 58, 19, 67, 17, 77, 17, 87, 17, 96, 19,
+  104, 22, 110, 25, 115, 30, 119, 36, 121, 42, 122, 50, 121, 56, 120, 62,
+  117, 67, 113, 71, 109, 75, 102, 78, 95, 81, 86, 83, 70, 86, 60, 88, 50, 91,
+  42, 95, 35, 99, 30, 103, 24, 110, 20, 118, 18, 127, 17, 137, 18, 146,
+  20, 155, 23, 163, 28, 170, 34, 176, 42, 181, 50, 185, 60, 188, 71, 189,
+  82, 190, 96, 189, 109, 188, 123, 185, END, 0, -1, 187, 157, 187, 157, 165,
+  91, 165, 91, 0, 66, 0, 66, 165, -1, 165, END, 0, 22, 187, 48, 187, 48, 73,
+  48, 62, 49, 52, 52, 43, 55, 36, 59, 30, 63, 25, 69, 22, 76, 19, 85, 17,
+  94, 17, 103, 17, 111, 19, 118, 22, 124, 25, 129, 30, 133, 36, 136, 43,
+  138, 52, 139, 62, 140, 73, 140, 187, 165, 187, 165, 70, 165, 58, 163, 48,
+  161, 38, 157, 29, 153, 22, 147, 15, 141, 9, 133, 5, 125, 1, 115, -2, 105, -3,
+  94, -4, 82, -3, 72, -2, 63, 1, 54, 5, 47, 9, 40, 15, 35, 22, 30, 29, 27, 38,
+  24, 48, 23, 58, 22, 70, END, 0, 73, 0, 2, 187, 28, 187, 88, 30, 147, 187,
+  173, 187, 102, 0, END, 0, 9, 187, 34, 187, 73, 29, 112, 187, 141, 187,
+  180, 29, 219, 187, 245, 187, 198, 0, 166, 0, 127, 162, 87, 0, 55, 0, END, 0,
+  16, 187, 43, 187, 90, 117, 136, 187, 163, 187, 103, 97, 167, 0, 140, 0,
+  88, 79, 35, 0, 8, 0, 74, 100, END, 0, -1, 187, 27, 187, 78, 110, 130, 187,
+  157, 187, 91, 89, 91, 0, 66, 0, 66, 89, END, 0, 14, 187, 161, 187, 161, 167,
+  43, 21, 164, 21, 164, 0, 12, 0, 12, 19, 130, 165, 14, 165, END, 0, 22, 195,
+  75, 195, 75, 177, 45, 177, 45, -16, 75, -16, 75, -34, 22, -34, END, 0,
+  21, 187, 86, -24, 65, -24, 0, 187, END, 0, 78, 195, 78, -34, 25, -34,
+  25, -16, 55, -16, 55, 177, 25, 177, 25, 195, END, 0, 120, 187, 187, 117,
+  162, 117, 107, 166, 52, 117, 27, 117, 95, 187, END, 0, 131, -43, 131, -60,
+  -3, -60, -3, -43, END, 0, 46, 205, 81, 158, 62, 158, 21, 205, END, 0, 88, 70,
+  77, 70, 68, 69, 60, 68, 54, 66, 49, 64, 44, 60, 41, 55, 39, 49, 38, 42,
+  39, 36, 40, 31, 43, 27, 46, 23, 51, 20, 56, 17, 62, 16, 68, 16, 77, 16,
+  86, 19, 93, 23, 99, 29, 104, 36, 108, 45, 110, 55, 111, 65, 111, 70, END, 0,
+  134, 80, 134, 0, 111, 0, 111, 21, 105, 13, 98, 7, 91, 2, 83, -1, 73, -3,
+  62, -4, 52, -3, 43, -1, 35, 3, 28, 8, 22, 15, 19, 23, 16, 31, 15, 41, 16, 50,
+  18, 58, 21, 65, 25, 71, 31, 76, 38, 81, 46, 84, 56, 86, 66, 88, 78, 88,
+  111, 88, 111, 91, 110, 98, 108, 105, 105, 110, 100, 115, 94, 119, 88, 122,
+  80, 123, 71, 124, 59, 123, 48, 121, 36, 117, 26, 112, 26, 134, 38, 138,
+  50, 141, 62, 143, 73, 143, 85, 143, 95, 141, 104, 138, 112, 133, 119, 128,
+  124, 121, 128, 112, 131, 103, 133, 92, END, 0, 125, 70, 124, 82, 122, 93,
+  119, 102, 114, 110, 110, 115, 105, 119, 99, 122, 92, 124, 86, 124, 79, 124,
+  72, 122, 66, 119, 61, 115, 57, 110, 52, 102, 49, 93, 47, 82, 46, 70, 47, 58,
+  49, 47, 52, 38, 57, 30, 61, 25, 66, 21, 72, 18, 79, 16, 86, 16, 92, 16,
+  99, 18, 105, 21, 110, 25, 114, 30, 119, 38, 122, 47, 124, 58, END, 0,
+  46, 119, 52, 126, 58, 133, 65, 137, 73, 141, 81, 143, 91, 143, 101, 143,
+  110, 140, 118, 136, 126, 130, 133, 123, 138, 115, 143, 105, 146, 94, 148, 83,
+  149, 70, 148, 57, 146, 46, 143, 35, 138, 25, 133, 17, 126, 9, 118, 4, 110, 0,
+  101, -3, 91, -4, 81, -3, 73, -1, 65, 2, 58, 7, 52, 13, 46, 21, 46, 0, 23, 0,
+  23, 195, 46, 195, END, 0, 125, 135, 125, 113, 115, 118, 105, 121, 95, 123,
+  86, 124, 77, 123, 69, 122, 62, 119, 56, 115, 51, 110, 46, 104, 43, 96,
+  40, 89, 39, 80, 38, 70, 39, 60, 40, 51, 43, 43, 46, 36, 51, 30, 56, 25,
+  62, 21, 69, 18, 77, 16, 86, 16, 95, 17, 105, 19, 115, 22, 125, 27, 125, 5,
+  115, 1, 105, -1, 94, -3, 83, -4, 71, -3, 60, 0, 50, 4, 41, 9, 33, 16, 26, 25,
+  21, 34, 17, 45, 15, 57, 14, 70, 15, 83, 17, 95, 21, 106, 26, 115, 33, 124,
+  41, 131, 50, 136, 61, 140, 72, 143, 85, 143, 95, 143, 105, 141, 115, 138,
+  END, 0, 116, 119, 116, 195, 139, 195, 139, 0, 116, 0, 116, 21, 111, 13,
+  105, 7, 98, 2, 90, -1, 81, -3, 71, -4, 62, -3, 53, 0, 44, 4, 37, 9, 30, 17,
+  24, 25, 20, 35, 17, 46, 15, 57, 14, 70, 15, 83, 17, 94, 20, 105, 24, 115,
+  30, 123, 37, 130, 44, 136, 53, 140, 62, 143, 71, 143, 81, 143, 90, 141,
+  98, 137, 105, 133, 111, 126, END, 0, 38, 70, 39, 58, 40, 47, 44, 38, 48, 30,
+  53, 25, 58, 21, 64, 18, 70, 16, 77, 16, 84, 16, 90, 18, 96, 21, 101, 25,
+  106, 30, 110, 38, 114, 47, 116, 58, 116, 70, 116, 82, 114, 93, 110, 102,
+  106, 110, 101, 115, 96, 119, 90, 122, 84, 124, 77, 124, 70, 124, 64, 122,
+  58, 119, 53, 115, 48, 110, 44, 102, 40, 93, 39, 82, END, 0, 144, 76, 144, 65,
+  38, 65, 40, 53, 42, 44, 47, 35, 52, 28, 59, 23, 68, 19, 77, 17, 88, 16,
+  101, 17, 114, 19, 126, 23, 139, 29, 139, 7, 126, 3, 113, -1, 100, -3, 87, -4,
+  74, -3, 62, -1, 52, 3, 42, 9, 34, 16, 27, 24, 21, 34, 17, 44, 15, 56, 14, 69,
+  15, 82, 17, 94, 21, 105, 26, 115, 33, 123, 41, 130, 50, 136, 60, 140,
+  71, 143, 83, 143, 94, 143, 103, 140, 112, 137, 120, 132, 127, 125, 133, 117,
+  138, 109, 141, 99, 143, 88, END, 0, 121, 83, 120, 91, 118, 99, 115, 107,
+  110, 113, 105, 118, 98, 121, 91, 123, 83, 124, 74, 123, 66, 121, 58, 118,
+  52, 113, 47, 107, 43, 100, 40, 92, 39, 82, END, 0, 95, 195, 95, 175, 73, 175,
+  67, 175, 63, 174, 59, 173, 56, 170, 54, 167, 52, 163, 51, 158, 51, 152,
+  51, 140, 89, 140, 89, 122, 51, 122, 51, 0, 28, 0, 28, 122, 6, 122, 6, 140,
+  28, 140, 28, 150, 28, 159, 30, 166, 32, 173, 35, 179, 39, 184, 44, 188,
+  49, 191, 56, 193, 64, 194, 73, 195, END, 0, 116, 72, 116, 83, 114, 94,
+  110, 103, 106, 110, 101, 115, 96, 119, 91, 122, 84, 124, 77, 124, 68, 123,
+  61, 121, 54, 116, 48, 110, 44, 103, 40, 94, 39, 83, 38, 72, 39, 60, 40, 50,
+  44, 41, 48, 33, 54, 27, 61, 23, 68, 20, 77, 19, 84, 20, 91, 21, 96, 24,
+  101, 28, 106, 33, 110, 41, 114, 50, 116, 60, END, 0, 139, 17, 139, 4,
+  137, -8, 134, -19, 129, -28, 123, -36, 116, -42, 108, -47, 98, -50, 87, -53,
+  75, -53, 63, -53, 52, -51, 41, -49, 31, -46, 31, -24, 41, -28, 51, -32,
+  61, -34, 71, -34, 80, -34, 87, -32, 94, -30, 100, -27, 105, -22, 109, -17,
+  112, -11, 114, -4, 116, 4, 116, 13, 116, 25, 111, 17, 105, 11, 98, 6, 90, 3,
+  81, 1, 71, 0, 61, 1, 52, 3, 44, 7, 37, 13, 30, 20, 24, 28, 20, 37, 17, 48,
+  15, 59, 14, 72, 15, 84, 17, 96, 20, 106, 24, 115, 30, 124, 37, 131, 44, 136,
+  52, 140, 61, 143, 71, 143, 81, 143, 90, 141, 98, 137, 105, 132, 111, 126,
+  116, 119, 116, 140, 139, 140, END, 0, 141, 85, 141, 0, 118, 0, 118, 84,
+  117, 93, 116, 101, 113, 108, 110, 114, 105, 118, 100, 121, 94, 123, 87, 123,
+  78, 123, 70, 120, 63, 117, 57, 112, 52, 105, 49, 97, 47, 89, 46, 79, 46, 0,
+  23, 0, 23, 195, 46, 195, 46, 118, 52, 126, 59, 132, 66, 137, 74, 141,
+  82, 143, 92, 143, 101, 143, 109, 141, 116, 138, 123, 134, 128, 128, 133, 122,
+  136, 114, 139, 105, 140, 96, END, 0, 24, 140, 47, 140, 47, 0, 24, 0, END, 0,
+  24, 195, 47, 195, 47, 165, 24, 165, END, 0, 24, 140, 47, 140, 47, -3,
+  47, -13, 45, -22, 43, -29, 41, -36, 37, -41, 32, -46, 27, -49, 20, -51,
+  13, -53, 4, -53, -5, -53, -5, -34, 2, -34, 8, -33, 13, -32, 16, -30, 19, -28,
+  21, -24, 23, -18, 24, -11, 24, -3, END, 0, 24, 195, 47, 195, 47, 165,
+  24, 165, END, 0, 23, 195, 46, 195, 46, 80, 115, 140, 144, 140, 70, 75,
+  148, 0, 118, 0, 46, 68, 46, 0, 23, 0, END, 0, 24, 195, 47, 195, 47, 0, 24, 0,
+  END, 0, 133, 113, 139, 123, 146, 130, 154, 136, 162, 140, 172, 143, 182, 143,
+  190, 143, 198, 141, 205, 138, 211, 134, 216, 128, 220, 121, 223, 114,
+  226, 105, 227, 95, 228, 85, 228, 0, 205, 0, 205, 84, 204, 93, 203, 101,
+  200, 108, 197, 114, 193, 118, 188, 121, 182, 123, 176, 123, 167, 123,
+  160, 120, 153, 117, 147, 112, 143, 105, 140, 97, 138, 89, 137, 79, 137, 0,
+  114, 0, 114, 84, 113, 93, 112, 101, 110, 108, 107, 114, 103, 118, 98, 121,
+  92, 123, 85, 123, 76, 123, 69, 120, 62, 117, 57, 111, 52, 105, 49, 97,
+  47, 89, 46, 79, 46, 0, 23, 0, 23, 140, 46, 140, 46, 118, 52, 126, 58, 132,
+  65, 137, 73, 141, 82, 143, 91, 143, 99, 143, 105, 141, 112, 139, 117, 136,
+  124, 130, 129, 122, END, 0, 141, 85, 141, 0, 118, 0, 118, 84, 117, 93,
+  116, 101, 113, 108, 110, 114, 105, 118, 100, 121, 94, 123, 87, 123, 78, 123,
+  70, 120, 63, 117, 57, 112, 52, 105, 49, 97, 47, 89, 46, 79, 46, 0, 23, 0,
+  23, 140, 46, 140, 46, 118, 52, 126, 59, 132, 66, 137, 74, 141, 82, 143,
+  92, 143, 101, 143, 109, 141, 116, 138, 123, 134, 128, 128, 133, 122,
+  136, 114, 139, 105, 140, 96, END, 0, 78, 124, 71, 123, 65, 122, 59, 119,
+  54, 115, 49, 109, 44, 102, 41, 92, 39, 82, 38, 70, 39, 58, 41, 47, 44, 38,
+  49, 30, 54, 25, 59, 21, 65, 18, 71, 16, 78, 16, 85, 16, 92, 18, 98, 21,
+  103, 25, 108, 30, 112, 38, 116, 48, 118, 58, 118, 70, 118, 82, 116, 92,
+  112, 101, 108, 109, 103, 115, 98, 119, 92, 122, 85, 123, END, 0, 78, 143,
+  90, 143, 100, 140, 110, 136, 118, 131, 126, 124, 132, 115, 136, 106, 140, 95,
+  142, 83, 143, 70, 142, 57, 140, 45, 136, 34, 132, 24, 126, 16, 118, 9,
+  110, 3, 100, -1, 90, -3, 78, -4, 67, -3, 56, -1, 47, 3, 38, 9, 31, 16,
+  25, 24, 20, 34, 17, 45, 15, 57, 14, 70, 15, 83, 17, 95, 20, 106, 25, 115,
+  31, 124, 38, 131, 47, 136, 56, 140, 67, 143, END, 0, 46, 21, 46, -53,
+  23, -53, 23, 140, 46, 140, 46, 119, 52, 126, 58, 133, 65, 137, 73, 141,
+  81, 143, 91, 143, 101, 143, 110, 140, 118, 136, 126, 130, 133, 123, 138, 115,
+  143, 105, 146, 94, 148, 83, 149, 70, 148, 57, 146, 46, 143, 35, 138, 25,
+  133, 17, 126, 9, 118, 4, 110, 0, 101, -3, 91, -4, 81, -3, 73, -1, 65, 2,
+  58, 7, 52, 13, END, 0, 125, 70, 124, 82, 122, 93, 119, 102, 114, 110,
+  110, 115, 105, 119, 99, 122, 92, 124, 86, 124, 79, 124, 72, 122, 66, 119,
+  61, 115, 57, 110, 52, 102, 49, 93, 47, 82, 46, 70, 47, 58, 49, 47, 52, 38,
+  57, 30, 61, 25, 66, 21, 72, 18, 79, 16, 86, 16, 92, 16, 99, 18, 105, 21,
+  110, 25, 114, 30, 119, 38, 122, 47, 124, 58, END, 0, 38, 70, 39, 58, 40, 47,
+  44, 38, 48, 30, 53, 25, 58, 21, 64, 18, 70, 16, 77, 16, 84, 16, 90, 18,
+  96, 21, 101, 25, 106, 30, 110, 38, 114, 47, 116, 58, 116, 70, 116, 82,
+  114, 93, 110, 102, 106, 110, 101, 115, 96, 119, 90, 122, 84, 124, 77, 124,
+  70, 124, 64, 122, 58, 119, 53, 115, 48, 110, 44, 102, 40, 93, 39, 82, END, 0,
+  116, 21, 111, 13, 105, 7, 98, 2, 90, -1, 81, -3, 71, -4, 62, -3, 53, 0,
+  44, 4, 37, 9, 30, 17, 24, 25, 20, 35, 17, 46, 15, 57, 14, 70, 15, 83, 17, 94,
+  20, 105, 24, 115, 30, 123, 37, 130, 44, 136, 53, 140, 62, 143, 71, 143,
+  81, 143, 90, 141, 98, 137, 105, 133, 111, 126, 116, 119, 116, 140, 139, 140,
+  139, -53, 116, -53, END, 0, 105, 119, 101, 120, 97, 122, 92, 123, 87, 123,
+  78, 122, 70, 120, 63, 116, 57, 110, 52, 103, 49, 95, 47, 85, 46, 74, 46, 0,
+  23, 0, 23, 140, 46, 140, 46, 118, 52, 126, 58, 132, 65, 137, 74, 141,
+  83, 143, 94, 143, 99, 143, 105, 142, END, 0, 113, 136, 113, 114, 103, 119,
+  93, 122, 82, 124, 71, 124, 63, 124, 56, 123, 50, 121, 46, 119, 42, 116,
+  39, 112, 38, 108, 37, 103, 38, 98, 40, 94, 43, 91, 47, 88, 52, 86, 59, 84,
+  68, 82, 76, 80, 87, 77, 97, 74, 104, 70, 111, 65, 115, 60, 118, 54, 120, 47,
+  121, 39, 120, 31, 118, 24, 115, 18, 111, 13, 105, 8, 99, 4, 91, 0, 83, -2,
+  73, -3, 63, -4, 52, -3, 40, -1, 27, 1, 14, 5, 14, 29, 27, 23, 39, 19, 51, 16,
+  64, 16, 71, 16, 78, 17, 84, 19, 89, 21, 92, 24, 95, 28, 97, 32, 97, 37,
+  97, 43, 94, 47, 91, 51, 87, 54, 81, 56, 73, 59, 63, 61, 55, 63, 45, 65,
+  37, 68, 30, 72, 24, 77, 20, 82, 17, 88, 15, 94, 15, 102, 15, 110, 17, 116,
+  20, 123, 24, 128, 29, 133, 37, 137, 46, 141, 56, 143, 69, 143, 81, 143,
+  93, 142, 103, 139, END, 0, 47, 180, 47, 140, 94, 140, 94, 122, 47, 122,
+  47, 46, 47, 38, 48, 32, 49, 27, 52, 24, 54, 22, 59, 20, 64, 20, 71, 19,
+  94, 19, 94, 0, 71, 0, 61, 0, 52, 2, 45, 4, 39, 6, 34, 10, 30, 15, 27, 20,
+  25, 28, 24, 36, 24, 46, 24, 122, 7, 122, 7, 140, 24, 140, 24, 180, END, 0,
+  22, 55, 22, 140, 45, 140, 45, 56, 45, 47, 47, 39, 49, 32, 53, 26, 57, 22,
+  62, 19, 68, 17, 76, 16, 85, 17, 92, 19, 99, 23, 105, 28, 110, 35, 113, 42,
+  115, 51, 116, 61, 116, 140, 139, 140, 139, 0, 116, 0, 116, 22, 110, 14,
+  104, 7, 97, 3, 89, -1, 80, -3, 71, -4, 62, -3, 53, -1, 46, 2, 40, 6, 34, 11,
+  30, 18, 26, 26, 24, 34, 22, 44, END, 0, 80, 143, END, 0, 8, 140, 32, 140,
+  76, 23, 120, 140, 144, 140, 91, 0, 60, 0, END, 0, 11, 140, 34, 140, 63, 31,
+  91, 140, 118, 140, 147, 31, 176, 140, 199, 140, 162, 0, 135, 0, 105, 115,
+  75, 0, 47, 0, END, 0, 141, 140, 90, 72, 143, 0, 116, 0, 75, 55, 35, 0, 7, 0,
+  62, 73, 12, 140, 39, 140, 76, 90, 113, 140, END, 0, 82, -13, 78, -22,
+  75, -30, 71, -37, 67, -42, 63, -46, 58, -49, 53, -51, 46, -53, 39, -53,
+  20, -53, 20, -34, 34, -34, 40, -34, 45, -32, 49, -30, 51, -26, 54, -22,
+  57, -16, 60, -8, 64, 2, 8, 140, 32, 140, 76, 31, 120, 140, 144, 140, END, 0,
+  14, 140, 123, 140, 123, 119, 37, 18, 123, 18, 123, 0, 11, 0, 11, 21, 98, 122,
+  14, 122, END, 0, 131, -24, 131, -42, 123, -42, 111, -41, 102, -40, 93, -38,
+  86, -36, 81, -33, 78, -28, 75, -22, 73, -15, 71, -6, 71, 4, 71, 34, 70, 43,
+  69, 50, 67, 56, 64, 60, 60, 64, 55, 66, 48, 67, 40, 68, 32, 68, 32, 86,
+  40, 86, 48, 86, 55, 87, 60, 90, 64, 93, 67, 97, 69, 103, 70, 110, 71, 119,
+  71, 149, 71, 159, 73, 168, 75, 175, 78, 181, 81, 185, 86, 189, 93, 191,
+  102, 193, 111, 194, 123, 195, 131, 195, 131, 177, 122, 177, 114, 176,
+  108, 175, 103, 174, 99, 171, 97, 168, 95, 163, 94, 156, 94, 148, 94, 117,
+  94, 108, 93, 100, 91, 94, 88, 89, 85, 84, 81, 81, 75, 78, 69, 77, 75, 74,
+  81, 72, 85, 68, 88, 64, 91, 59, 93, 53, 94, 45, 94, 36, 94, 5, 94, -3,
+  95, -10, 97, -15, 99, -18, 103, -21, 108, -22, 114, -23, 122, -24, END, 0,
+  54, 196, 54, -60, 33, -60, 33, 196, END, 0, 32, -24, 41, -24, 49, -23,
+  55, -22, 60, -21, 64, -18, 66, -15, 68, -10, 69, -3, 69, 5, 69, 36, 69, 45,
+  70, 53, 72, 59, 75, 64, 78, 68, 82, 72, 88, 74, 94, 77, 88, 78, 82, 81,
+  78, 84, 75, 89, 72, 94, 70, 100, 69, 108, 69, 117, 69, 148, 69, 156, 68, 163,
+  66, 168, 64, 171, 60, 174, 55, 175, 49, 176, 41, 177, 32, 177, 32, 195,
+  40, 195, 51, 194, 61, 193, 70, 191, 76, 189, 81, 185, 85, 181, 88, 175,
+  90, 168, 91, 159, 92, 149, 92, 119, 92, 110, 94, 103, 96, 97, 99, 93,
+  103, 90, 108, 87, 115, 86, 123, 86, 131, 86, 131, 68, 123, 68, 115, 67,
+  108, 66, 103, 64, 99, 60, 96, 56, 94, 50, 92, 43, 92, 34, 92, 4, 91, -6,
+  90, -15, 88, -22, 85, -28, 81, -33, 76, -36, 70, -38, 61, -40, 51, -41,
+  40, -42, 32, -42, END, 0, 187, 102, 187, 80, 179, 74, 171, 69, 163, 66,
+  155, 63, 148, 62, 140, 62, 130, 62, 119, 65, 108, 69, 106, 70, 105, 70,
+  103, 71, 94, 74, 86, 76, 78, 78, 72, 78, 65, 78, 57, 76, 50, 74, 43, 70,
+  35, 65, 27, 58, 27, 81, 36, 87, 44, 91, 51, 95, 59, 97, 67, 99, 75, 99,
+  84, 98, 95, 96, 107, 92, 109, 91, 112, 90, 121, 86, 129, 84, 136, 83,
+  143, 82, 150, 83, 157, 84, 164, 87, 171, 91, 179, 96, END, 0,
+};
+
+#undef END
+
+// Returns the glyph of c. Characters without glyph are drawn as '?'
+const PNGFont::Glyph&
+PNGFont::getGlyph(char c)
+{
+  if (c < firstChar || c > lastChar)
+    c = '?';
+
+  return glyphs[c - firstChar];
+}
+
+// Returns the first coordinate pair of glyph
+const short*
+PNGFont::getPoints(const Glyph& glyph)
+{
+  return &points[2 * glyph.first];
+}
@@ -0,0 +1,68 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: PNGFont.h
+*	Author: Benjamin Wießneth
+*	Description: Vector font for the PNG rasterizer
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef PNGFONT_H
+#define PNGFONT_H
+
+// Built-in vector font used by the PNG rasterizer, so no font has to be
+// installed on the system
+class PNGFont
+{
+public:
+  // Outline of a single glyph. Coordinates are given in 1/256 em with the
+  // baseline at y = 0 and y pointing upwards
+  struct Glyph
+  {
+    short advance;        // Horizontal advance
+    unsigned short first; // Index of the first coordinate pair
+    unsigned short count; // Number of coordinate pairs
+  };
+
+  static const int unitsPerEm = 256;
+
+  // x value which closes the current contour of a glyph
+  static const short contourEnd = -32768;
+
+  // Range of characters with glyphs
+  static const char firstChar = ' ';
+  static const char lastChar = '~';
+
+  // Returns the glyph of c. Characters without glyph are drawn as '?'
+  static const Glyph& getGlyph(char c);
+
+  // Returns the first coordinate pair of glyph
+  static const short* getPoints(const Glyph& glyph);
+
+private:
+  static const Glyph glyphs[];
+  static const short points[];
+};
+
+#endif
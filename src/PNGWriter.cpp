@@ -0,0 +1,747 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: PNGWriter.cpp
+*	Author: Benjamin Wießneth
+*	Description: Rasterize the entity symbol to a PNG image
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "PNGWriter.h"
+#include "MSG.h"
+#include "PNGFont.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+static const double PI = 3.14159265358979323846;
+
+// Vertical samples per pixel row used for antialiasing
+static const int SUBSAMPLES = 4;
+
+// Distance of the baseline below the vertical center of a text in em
+static const double CENTRAL_BASELINE = 0.35;
+
+// Horizontal offset of the second pass which makes bold text in em
+static const double BOLD_OFFSET = 0.04;
+
+PNGWriter::PNGWriter(std::ostream& os)
+  : os(os)
+  , mSettings(cfg.getSnapshot())
+  , mScale(mSettings.png.dpi / 2.54)
+  , mWidth(0)
+  , mHeight(0)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "PNGWriter::PNGWriter(ostream& os)";
+}
+
+PNGWriter::~PNGWriter()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "PNGWriter::~PNGWriter()";
+}
+
+void
+PNGWriter::header(double width, double height)
+{
+  mWidth = std::max(1, (int)std::ceil(toPixel(width)));
+  mHeight = std::max(1, (int)std::ceil(toPixel(height)));
+
+  // White background
+  mPixels.assign((size_t)mWidth * mHeight * 3, 0xFF);
+
+  return;
+}
+
+void
+PNGWriter::footer()
+{
+  std::string png = encode();
+  os.write(png.data(), png.size());
+
+  return;
+}
+
+void
+PNGWriter::group(bool /*close*/)
+{
+  return;
+}
+
+void
+PNGWriter::line(double x1,
+                double y1,
+                double x2,
+                double y2,
+                std::string CSSclass)
+{
+  const ConfigSnapshot::Shape* shape = getShape(CSSclass);
+  Color color;
+  if (shape == nullptr || shape->strokeWidthValue <= 0 ||
+      !parseColor(shape->strokeColor, color))
+    return;
+
+  double length = std::hypot(x2 - x1, y2 - y1);
+  if (length <= 0)
+    return;
+
+  // Offset perpendicular to the line by half the stroke width
+  double dx = (y1 - y2) / length * shape->strokeWidthValue / 2;
+  double dy = (x2 - x1) / length * shape->strokeWidthValue / 2;
+
+  Contour contour = { { toPixel(x1 + dx), toPixel(y1 + dy) },
+                      { toPixel(x2 + dx), toPixel(y2 + dy) },
+                      { toPixel(x2 - dx), toPixel(y2 - dy) },
+                      { toPixel(x1 - dx), toPixel(y1 - dy) } };
+  fill(std::vector<Contour>(1, contour), color);
+
+  return;
+}
+
+void
+PNGWriter::rect(double x,
+                double y,
+                double width,
+                double height,
+                std::string CSSclass)
+{
+  const ConfigSnapshot::Shape* shape = getShape(CSSclass);
+  if (shape == nullptr)
+    return;
+
+  Color color;
+  std::vector<Contour> contours;
+
+  if (parseColor(shape->fillColor, color)) {
+    addRect(contours, x, y, x + width, y + height);
+    fill(contours, color);
+  }
+
+  // The stroke is centered on the outline like in SVG
+  double stroke = shape->strokeWidthValue / 2;
+  if (stroke > 0 && parseColor(shape->strokeColor, color)) {
+    contours.clear();
+    addRect(contours,
+            x - stroke,
+            y - stroke,
+            x + width + stroke,
+            y + height + stroke);
+    addRect(contours,
+            x + stroke,
+            y + stroke,
+            x + width - stroke,
+            y + height - stroke,
+            true);
+    fill(contours, color);
+  }
+
+  return;
+}
+
+void
+PNGWriter::circle(double x, double y, double radius, std::string CSSclass)
+{
+  const ConfigSnapshot::Shape* shape = getShape(CSSclass);
+  if (shape == nullptr)
+    return;
+
+  Color color;
+  std::vector<Contour> contours;
+
+  if (parseColor(shape->fillColor, color)) {
+    addCircle(contours, x, y, radius);
+    fill(contours, color);
+  }
+
+  // The stroke is centered on the outline like in SVG
+  double stroke = shape->strokeWidthValue / 2;
+  if (stroke > 0 && parseColor(shape->strokeColor, color)) {
+    contours.clear();
+    addCircle(contours, x, y, radius + stroke);
+    if (radius > stroke)
+      addCircle(contours, x, y, radius - stroke, true);
+    fill(contours, color);
+  }
+
+  return;
+}
+
+void
+PNGWriter::text(double x, double y, std::string text, std::string CSSclass)
+{
+  const ConfigSnapshot::Font* font = getFont(CSSclass);
+  if (font == nullptr || text.empty())
+    return;
+
+  // Font sizes are given in pt
+  double size = font->sizeValue / 72 * 2.54 * mScale;
+  double unit = size / PNGFont::unitsPerEm;
+  bool bold = (font->weight == "bold" || font->weight == "bolder" ||
+               std::atoi(font->weight.c_str()) >= 600);
+  double boldOffset = bold ? BOLD_OFFSET * size : 0;
+
+  double width = boldOffset;
+  for (char c : text)
+    width += PNGFont::getGlyph(c).advance * unit;
+
+  // Horizontal alignment and dominant baseline of the CSS class
+  double left = toPixel(x);
+  double baseline = toPixel(y);
+  std::string alignment;
+  size_t space = CSSclass.find(' ');
+  if (space != std::string::npos) {
+    alignment = CSSclass.substr(space + 1);
+    baseline += CENTRAL_BASELINE * size;
+  }
+  if (alignment == "right")
+    left -= width;
+  else if (alignment == "center")
+    left -= width / 2;
+
+  std::vector<Contour> contours;
+  for (char c : text) {
+    const PNGFont::Glyph& glyph = PNGFont::getGlyph(c);
+    const short* points = PNGFont::getPoints(glyph);
+
+    // Bold text is drawn a second time with a small offset
+    for (int pass = 0; pass < (bold ? 2 : 1); pass++) {
+      double offset = left + pass * boldOffset;
+      Contour contour;
+      for (int i = 0; i < glyph.count; i++) {
+        if (points[2 * i] == PNGFont::contourEnd) {
+          contours.push_back(contour);
+          contour.clear();
+        } else {
+          contour.push_back({ offset + points[2 * i] * unit,
+                              baseline - points[2 * i + 1] * unit });
+        }
+      }
+    }
+
+    left += glyph.advance * unit;
+  }
+
+  // Text is drawn in black like the SVG default
+  fill(contours, { 0, 0, 0 });
+
+  return;
+}
+
+void
+PNGWriter::fill(const std::vector<Contour>& contours, Color color)
+{
+  // Edge of a contour from top to bottom
+  struct Edge
+  {
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+    int winding;
+  };
+
+  std::vector<Edge> edges;
+  double minX = mWidth, minY = mHeight, maxX = 0, maxY = 0;
+  for (const Contour& contour : contours) {
+    for (size_t i = 0; i < contour.size(); i++) {
+      const Point& p1 = contour[i];
+      const Point& p2 = contour[(i + 1) % contour.size()];
+      minX = std::min(minX, p1.x);
+      minY = std::min(minY, p1.y);
+      maxX = std::max(maxX, p1.x);
+      maxY = std::max(maxY, p1.y);
+
+      if (p1.y < p2.y)
+        edges.push_back({ p1.x, p1.y, p2.x, p2.y, 1 });
+      else if (p1.y > p2.y)
+        edges.push_back({ p2.x, p2.y, p1.x, p1.y, -1 });
+    }
+  }
+
+  // Only the pixels covered by the bounding box are visited
+  int left = std::max(0, (int)std::floor(minX));
+  int right = std::min(mWidth, (int)std::ceil(maxX));
+  int top = std::max(0, (int)std::floor(minY));
+  int bottom = std::min(mHeight, (int)std::ceil(maxY));
+  if (left >= right || top >= bottom)
+    return;
+
+  std::vector<double> coverage(right - left + 1);
+  std::vector<std::pair<double, int>> crossings;
+
+  for (int row = top; row < bottom; row++) {
+    std::fill(coverage.begin(), coverage.end(), 0.0);
+
+    for (int sample = 0; sample < SUBSAMPLES; sample++) {
+      double y = row + (sample + 0.5) / SUBSAMPLES;
+
+      // Get all edges crossing the sample line
+      crossings.clear();
+      for (const Edge& edge : edges) {
+        if (y >= edge.y1 && y < edge.y2)
+          crossings.push_back({ edge.x1 + (y - edge.y1) * (edge.x2 - edge.x1) /
+                                            (edge.y2 - edge.y1),
+                                edge.winding });
+      }
+      std::sort(crossings.begin(), crossings.end());
+
+      // Spans with a nonzero winding number are inside. The horizontal
+      // coverage of the pixels at both ends of a span is exact
+      int winding = 0;
+      for (size_t i = 0; i + 1 < crossings.size(); i++) {
+        winding += crossings[i].second;
+        if (winding == 0)
+          continue;
+
+        double x1 = std::max((double)left, crossings[i].first) - left;
+        double x2 = std::min((double)right, crossings[i + 1].first) - left;
+        if (x1 >= x2)
+          continue;
+
+        int first = (int)x1;
+        int last = (int)x2;
+        if (first == last) {
+          coverage[first] += (x2 - x1) / SUBSAMPLES;
+        } else {
+          coverage[first] += (first + 1 - x1) / SUBSAMPLES;
+          for (int px = first + 1; px < last; px++)
+            coverage[px] += 1.0 / SUBSAMPLES;
+          coverage[last] += (x2 - last) / SUBSAMPLES;
+        }
+      }
+    }
+
+    // Blend color into the image
+    unsigned char* pixel = &mPixels[((size_t)row * mWidth + left) * 3];
+    for (int px = 0; px < right - left; px++, pixel += 3) {
+      double alpha = std::min(1.0, coverage[px]);
+      if (alpha <= 0)
+        continue;
+      pixel[0] = (unsigned char)std::lround(pixel[0] * (1 - alpha) +
+                                            color.r * alpha);
+      pixel[1] = (unsigned char)std::lround(pixel[1] * (1 - alpha) +
+                                            color.g * alpha);
+      pixel[2] = (unsigned char)std::lround(pixel[2] * (1 - alpha) +
+                                            color.b * alpha);
+    }
+  }
+
+  return;
+}
+
+void
+PNGWriter::addRect(std::vector<Contour>& contours,
+                   double x1,
+                   double y1,
+                   double x2,
+                   double y2,
+                   bool reverse)
+{
+  Contour contour = { { toPixel(x1), toPixel(y1) },
+                      { toPixel(x2), toPixel(y1) },
+                      { toPixel(x2), toPixel(y2) },
+                      { toPixel(x1), toPixel(y2) } };
+  if (reverse)
+    std::reverse(contour.begin(), contour.end());
+
+  contours.push_back(contour);
+
+  return;
+}
+
+void
+PNGWriter::addCircle(std::vector<Contour>& contours,
+                     double x,
+                     double y,
+                     double radius,
+                     bool reverse)
+{
+  // Segments are short enough to look round at any resolution
+  double r = toPixel(radius);
+  int segments = std::max(16, (int)std::ceil(r * 2));
+
+  Contour contour;
+  for (int i = 0; i < segments; i++) {
+    double angle = 2 * PI * (reverse ? segments - i : i) / segments;
+    contour.push_back(
+      { toPixel(x) + r * std::cos(angle), toPixel(y) + r * std::sin(angle) });
+  }
+
+  contours.push_back(contour);
+
+  return;
+}
+
+const ConfigSnapshot::Shape*
+PNGWriter::getShape(const std::string& CSSclass)
+{
+  if (CSSclass == "entityBox")
+    return &mSettings.entityShape;
+  if (CSSclass == "portBox")
+    return &mSettings.portShape;
+  if (CSSclass == "labelBox")
+    return &mSettings.labelShape;
+  if (CSSclass == "genericsBox")
+    return &mSettings.genericsShape;
+  if (CSSclass == "connector")
+    return &mSettings.connectorShape;
+
+  MSG(LOG_LEVEL::DEBUG) << "Unknown shape class " << CSSclass;
+  return nullptr;
+}
+
+const ConfigSnapshot::Font*
+PNGWriter::getFont(const std::string& CSSclass)
+{
+  std::string style = CSSclass.substr(0, CSSclass.find(' '));
+
+  if (style == "label")
+    return &mSettings.labelFont;
+  if (style == "entity")
+    return &mSettings.entityFont;
+  if (style == "port")
+    return &mSettings.portFont;
+  if (style == "vector")
+    return &mSettings.vectorFont;
+  if (style == "generics")
+    return &mSettings.genericSignalFont;
+
+  MSG(LOG_LEVEL::DEBUG) << "Unknown text class " << CSSclass;
+  return nullptr;
+}
+
+bool
+PNGWriter::parseColor(const std::string& str, Color& color)
+{
+  if ((str.length() != 4 && str.length() != 7) || str[0] != '#' ||
+      str.find_first_not_of("0123456789abcdefABCDEF", 1) != std::string::npos)
+    return false;
+
+  unsigned long value = std::strtoul(str.c_str() + 1, nullptr, 16);
+  if (str.length() == 4) {
+    // Each digit of #RGB is doubled
+    color.r = ((value >> 8) & 0xF) * 0x11;
+    color.g = ((value >> 4) & 0xF) * 0x11;
+    color.b = (value & 0xF) * 0x11;
+  } else {
+    color.r = (value >> 16) & 0xFF;
+    color.g = (value >> 8) & 0xFF;
+    color.b = value & 0xFF;
+  }
+
+  return true;
+}
+
+double
+PNGWriter::toPixel(double cm)
+{
+  return cm * mScale;
+}
+
+// Collects bits in the order used by deflate
+struct BitStream
+{
+  std::string data;
+  unsigned long buffer = 0;
+  int count = 0;
+
+  // Appends the lowest n bits of value, starting with the least significant
+  void write(unsigned long value, int n)
+  {
+    buffer |= value << count;
+    count += n;
+    while (count >= 8) {
+      data.push_back((char)(buffer & 0xFF));
+      buffer >>= 8;
+      count -= 8;
+    }
+  }
+
+  // Appends a Huffman code, starting with the most significant bit
+  void writeCode(unsigned long code, int n)
+  {
+    unsigned long reversed = 0;
+    for (int i = 0; i < n; i++)
+      reversed |= ((code >> i) & 1) << (n - 1 - i);
+    write(reversed, n);
+  }
+
+  // Pads the last byte with zeros
+  void flush()
+  {
+    if (count > 0)
+      write(0, 8 - count);
+  }
+};
+
+// Writes a literal/length symbol with the fixed Huffman code
+static void
+writeSymbol(BitStream& bits, int symbol)
+{
+  if (symbol < 144)
+    bits.writeCode(0x30 + symbol, 8);
+  else if (symbol < 256)
+    bits.writeCode(0x190 + symbol - 144, 9);
+  else if (symbol < 280)
+    bits.writeCode(symbol - 256, 7);
+  else
+    bits.writeCode(0xC0 + symbol - 280, 8);
+}
+
+// Writes a match of length bytes found distance bytes before
+static void
+writeMatch(BitStream& bits, int length, int distance)
+{
+  static const int lengthBase[] = { 3,  4,  5,  6,   7,   8,   9,   10,
+                                    11, 13, 15, 17,  19,  23,  27,  31,
+                                    35, 43, 51, 59,  67,  83,  99,  115,
+                                    131, 163, 195, 227, 258 };
+  static const int lengthExtra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                     1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                     4, 4, 4, 4, 5, 5, 5, 5, 0 };
+  static const int distanceBase[] = { 1,    2,    3,    4,     5,     7,
+                                      9,    13,   17,   25,    33,    49,
+                                      65,   97,   129,  193,   257,   385,
+                                      513,  769,  1025, 1537,  2049,  3073,
+                                      4097, 6145, 8193, 12289, 16385, 24577 };
+  static const int distanceExtra[] = { 0, 0, 0, 0, 1, 1, 2,  2,  3,  3,
+                                       4, 4, 5, 5, 6, 6, 7,  7,  8,  8,
+                                       9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+  int code = 28;
+  while (lengthBase[code] > length)
+    code--;
+  writeSymbol(bits, 257 + code);
+  bits.write(length - lengthBase[code], lengthExtra[code]);
+
+  code = 29;
+  while (distanceBase[code] > distance)
+    code--;
+  bits.writeCode(code, 5);
+  bits.write(distance - distanceBase[code], distanceExtra[code]);
+}
+
+// Compresses data to a zlib stream. A single block with the fixed Huffman
+// codes is enough, as the images consist mostly of repeated rows and runs
+static std::string
+compress(const std::string& data)
+{
+  const int WINDOW = 32768;
+  const int MAX_MATCH = 258;
+  const int MAX_CHAIN = 64;
+  const int HASH_SIZE = 1 << 15;
+
+  BitStream bits;
+  bits.data.reserve(data.size() / 4 + 64);
+
+  // zlib header: deflate with 32K window, no preset dictionary
+  bits.write(0x78, 8);
+  bits.write(0x01, 8);
+
+  // Final block with fixed Huffman codes
+  bits.write(1, 1);
+  bits.write(1, 2);
+
+  // Last position of each hash value and the previous position with the same
+  // hash for each position in the window
+  std::vector<int> head(HASH_SIZE, -1);
+  std::vector<int> previous(WINDOW, -1);
+  const unsigned char* bytes = (const unsigned char*)data.data();
+  int size = (int)data.size();
+
+  auto hash = [bytes](int pos) {
+    return ((bytes[pos] << 10) ^ (bytes[pos + 1] << 5) ^ bytes[pos + 2]) &
+           (HASH_SIZE - 1);
+  };
+  auto insert = [&](int pos) {
+    if (pos + 2 < size) {
+      int h = hash(pos);
+      previous[pos % WINDOW] = head[h];
+      head[h] = pos;
+    }
+  };
+
+  int pos = 0;
+  while (pos < size) {
+    int bestLength = 0;
+    int bestDistance = 0;
+
+    if (pos + 2 < size) {
+      int candidate = head[hash(pos)];
+      int maxLength = std::min(MAX_MATCH, size - pos);
+      for (int chain = 0; chain < MAX_CHAIN && candidate >= 0 &&
+                          pos - candidate <= WINDOW;
+           chain++) {
+        int length = 0;
+        while (length < maxLength &&
+               bytes[candidate + length] == bytes[pos + length])
+          length++;
+        if (length > bestLength) {
+          bestLength = length;
+          bestDistance = pos - candidate;
+          if (length == maxLength)
+            break;
+        }
+        candidate = previous[candidate % WINDOW];
+      }
+    }
+
+    if (bestLength >= 3) {
+      writeMatch(bits, bestLength, bestDistance);
+      for (int i = 0; i < bestLength; i++)
+        insert(pos + i);
+      pos += bestLength;
+    } else {
+      writeSymbol(bits, bytes[pos]);
+      insert(pos);
+      pos++;
+    }
+  }
+
+  // End of block
+  writeSymbol(bits, 256);
+  bits.flush();
+
+  // Adler-32 checksum of the uncompressed data
+  unsigned long a = 1, b = 0;
+  for (int i = 0; i < size; i++) {
+    a = (a + bytes[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  unsigned long adler = (b << 16) | a;
+  for (int shift = 24; shift >= 0; shift -= 8)
+    bits.data.push_back((char)((adler >> shift) & 0xFF));
+
+  return bits.data;
+}
+
+// Appends a 32 bit value in network byte order
+static void
+appendUInt32(std::string& str, unsigned long value)
+{
+  for (int shift = 24; shift >= 0; shift -= 8)
+    str.push_back((char)((value >> shift) & 0xFF));
+}
+
+// Appends a PNG chunk with its length and CRC
+static void
+appendChunk(std::string& png, const char* type, const std::string& data)
+{
+  static const std::vector<unsigned long> crcTable = [] {
+    std::vector<unsigned long> table(256);
+    for (unsigned long n = 0; n < 256; n++) {
+      unsigned long c = n;
+      for (int k = 0; k < 8; k++)
+        c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+    return table;
+  }();
+
+  appendUInt32(png, data.size());
+  size_t start = png.size();
+  png.append(type, 4);
+  png.append(data);
+
+  // The CRC covers the chunk type and data
+  unsigned long crc = 0xFFFFFFFFUL;
+  for (size_t i = start; i < png.size(); i++)
+    crc = crcTable[(crc ^ (unsigned char)png[i]) & 0xFF] ^ (crc >> 8);
+  appendUInt32(png, crc ^ 0xFFFFFFFFUL);
+}
+
+std::string
+PNGWriter::encode()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "PNGWriter::encode()";
+
+  // Filter each row with the filter giving the smallest sum of absolute
+  // differences. Filter types are None, Sub, Up and Paeth
+  size_t stride = (size_t)mWidth * 3;
+  std::string filtered;
+  filtered.reserve((stride + 1) * mHeight);
+  std::string candidates[4];
+  const int types[4] = { 0, 1, 2, 4 };
+
+  for (int row = 0; row < mHeight; row++) {
+    const unsigned char* current = &mPixels[row * stride];
+    const unsigned char* above = row > 0 ? current - stride : nullptr;
+
+    int best = 0;
+    unsigned long bestSum = ~0UL;
+    for (int t = 0; t < 4; t++) {
+      std::string& out = candidates[t];
+      out.resize(stride);
+      unsigned long sum = 0;
+      for (size_t i = 0; i < stride; i++) {
+        int a = i >= 3 ? current[i - 3] : 0;
+        int b = above ? above[i] : 0;
+        int c = (above && i >= 3) ? above[i - 3] : 0;
+        int predictor = 0;
+        if (types[t] == 1)
+          predictor = a;
+        else if (types[t] == 2)
+          predictor = b;
+        else if (types[t] == 4) {
+          int p = a + b - c;
+          int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+          predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+        }
+        unsigned char value = (unsigned char)(current[i] - predictor);
+        out[i] = (char)value;
+        sum += value < 128 ? value : 256 - value;
+      }
+      if (sum < bestSum) {
+        bestSum = sum;
+        best = t;
+      }
+    }
+
+    filtered.push_back((char)types[best]);
+    filtered.append(candidates[best]);
+  }
+
+  // Image header: 8 bit RGB, no interlacing
+  std::string ihdr;
+  appendUInt32(ihdr, mWidth);
+  appendUInt32(ihdr, mHeight);
+  ihdr += std::string("\x08\x02\x00\x00\x00", 5);
+
+  // Physical pixel dimensions in pixels per meter
+  std::string phys;
+  unsigned long ppm = std::lround(mScale * 100);
+  appendUInt32(phys, ppm);
+  appendUInt32(phys, ppm);
+  phys.push_back(1);
+
+  std::string png("\x89PNG\r\n\x1a\n", 8);
+  appendChunk(png, "IHDR", ihdr);
+  appendChunk(png, "pHYs", phys);
+  appendChunk(png, "IDAT", compress(filtered));
+  appendChunk(png, "IEND", "");
+
+  return png;
+}
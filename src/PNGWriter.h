@@ -0,0 +1,149 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: PNGWriter.h
+*	Author: Benjamin Wießneth
+*	Description: Rasterize the entity symbol to a PNG image
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef PNGWRITER_H
+#define PNGWRITER_H
+
+#include "Config.h"
+#include "DrawingWriter.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Draws the symbol into an RGB bitmap and writes it as PNG image. Styles are
+// taken from the config the same way SVGWriter does for its CSS classes
+class PNGWriter : public DrawingWriter
+{
+public:
+  // Creates a PNGWriter object. The image is written to os by footer()
+  PNGWriter(std::ostream& os);
+
+  ~PNGWriter(void);
+
+  // Creates a white image with the given dimensions. The resolution is taken
+  // from PNG.dpi
+  void header(double width, double height) override;
+
+  // Encodes the image and writes it to the output stream
+  void footer() override;
+
+  // Groups have no effect on the image
+  void group(bool close = false) override;
+
+  // Draws a line with the stroke of CSSclass
+  void line(double x1,
+            double y1,
+            double x2,
+            double y2,
+            std::string CSSclass) override;
+
+  // Draws a filled rectangle with the stroke of CSSclass
+  void rect(double x,
+            double y,
+            double width,
+            double height,
+            std::string CSSclass) override;
+
+  // Draws a filled circle with the stroke of CSSclass
+  void circle(double x,
+              double y,
+              double radius,
+              std::string CSSclass) override;
+
+  // Draws text with the font and alignment of CSSclass
+  void text(double x,
+            double y,
+            std::string text,
+            std::string CSSclass) override;
+
+private:
+  struct Color
+  {
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+  };
+
+  // Position in pixels
+  struct Point
+  {
+    double x;
+    double y;
+  };
+
+  typedef std::vector<Point> Contour;
+
+  // Fills the area enclosed by contours using the nonzero winding rule. Edges
+  // are antialiased
+  void fill(const std::vector<Contour>& contours, Color color);
+
+  // Adds a rectangle to contours. Reversed rectangles cut holes into others
+  void addRect(std::vector<Contour>& contours,
+               double x1,
+               double y1,
+               double x2,
+               double y2,
+               bool reverse = false);
+
+  // Adds a circle to contours. Reversed circles cut holes into others
+  void addCircle(std::vector<Contour>& contours,
+                 double x,
+                 double y,
+                 double radius,
+                 bool reverse = false);
+
+  // Returns the shape style of CSSclass or nullptr if it's unknown
+  const ConfigSnapshot::Shape* getShape(const std::string& CSSclass);
+
+  // Returns the font of the first word of CSSclass or nullptr if it's unknown
+  const ConfigSnapshot::Font* getFont(const std::string& CSSclass);
+
+  // Parses colors given as #RGB or #RRGGBB
+  static bool parseColor(const std::string& str, Color& color);
+
+  // Converts cm to pixels
+  double toPixel(double cm);
+
+  // Returns the image as PNG file
+  std::string encode();
+
+  std::ostream& os;
+
+  // Typed config values for styles
+  const ConfigSnapshot& mSettings;
+
+  double mScale; // Pixels per cm
+  int mWidth;
+  int mHeight;
+  std::vector<unsigned char> mPixels; // RGB values, row by row
+};
+
+#endif
@@ -33,217 +33,87 @@
 #include "MSG.h"
 #include "SVGWriter.h"
 
-SVG::SVG(VHDLEntity sourceEntity)
-  : OFileHandler(sourceEntity, "SVG", "svg", "")
+SVG::SVG(const VHDLEntity& sourceEntity,
+         const Layout& layout,
+         std::ostream& os)
+  : OFileHandler(sourceEntity, os)
+  , mLayout(layout)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "SVG::SVG(VHDLEntity sourceEntity)";
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mConfigName = " << mConfigName;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mExtension = " << mExtension;
-  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "mSuffix = " << mSuffix;
+    << "SVG::SVG(const VHDLEntity& sourceEntity)";
 
-  initValues();
-  translate();
+  SVGWriter writer(mOutput);
+
+  translate(writer);
 }
 
-void
-SVG::initValues()
+SVG::SVG(const VHDLEntity& sourceEntity,
+         const Layout& layout,
+         std::ostream& os,
+         DrawingWriter& writer)
+  : OFileHandler(sourceEntity, os)
+  , mLayout(layout)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
-    << "SVG::initValues(VHDLEntity mSourceEntity)";
-  // Initialize global variables
-  groupHeight = 0;
-  entityHeight = 0;
-  genericWidth = 0;
-  genericHeight = 0;
-  originX = 0;
-  originY = 0;
-  clockPort = -1;
-  resetPort = -1;
-  vectorTextLenghtIn = 0;
-  vectorTextLenghtOut = 0;
-
-  // Load custom settings from config file
-  fontSize = cfg.getDouble("port.fontSize");
-  entity_fontSize = cfg.getDouble("entity.fontSize");
-  generics_fontSize = cfg.getDouble("genericSignal.fontSize");
-  clockName = cfg.getString("clockName");
-  resetName = cfg.getString("resetName");
-  fixedWidth = cfg.getDouble("fixedWidth");
-  horizontal_Margin = cfg.getDouble("horizontal_Margin");
-  vertical_Margin = cfg.getDouble("vertical_Margin");
-  //	labelBox_visible = cfg.getBool("labelBox_visible");
-
-  int noInputs = mSourceEntity.getNumberOfInputs();
-  int noOutputs = mSourceEntity.getNumberOfOutputs();
-
-  // Calculate entityHeight depending on total number of ports and the presence
-  // of special ports No clock port and no reset port
-  if ((mSourceEntity.getClockPort() == -1) &&
-      (mSourceEntity.getResetPort() == -1)) {
-    entityHeight = max(noInputs, noOutputs);
-  }
-  // One clock port and no reset port
-  else if ((mSourceEntity.getClockPort() != -1) &&
-           (mSourceEntity.getResetPort() == -1)) {
-    if (noInputs - 1 >= noOutputs)
-      entityHeight = noInputs;
-    else
-      entityHeight = noOutputs;
-  }
-  // No clock port and one reset port
-  else if ((mSourceEntity.getClockPort() == -1) &&
-           (mSourceEntity.getResetPort() != -1)) {
-    if (noInputs - 1 >= noOutputs)
-      entityHeight = noInputs;
-    else
-      entityHeight = noOutputs + 1;
-
-    // Reset connector facing downward => +1
-    groupHeight = 1.0;
-  }
-  // One clock port and one reset port
-  else if ((mSourceEntity.getClockPort() != -1) &&
-           (mSourceEntity.getResetPort() != -1)) {
-    if ((noInputs - 2) >= noOutputs)
-      entityHeight = noInputs;
-    else
-      entityHeight = noOutputs + 1;
-
-    // Reset connector facing downward => +1
-    groupHeight = 1.0;
-  }
-
-  // Add 1cm for entity caption (always present)
-  entityHeight += 1;
-
-  // includes label
-  groupHeight = groupHeight + entityHeight + 1;
-
-  // Calculate the portWidth or use a fixed width
-  if (fixedWidth <= 0) {
-    // Calculate the portWidth depending on the maximum length of the port names
-    // if no config value is given Get longest portname
-    int charCount = 0;
-    for (int i = 0; i < mSourceEntity.getNumberOfInputs(); i++)
-      charCount = max(charCount, (int)mSourceEntity.getPortName(i).length());
-    for (int i = 0; i < mSourceEntity.getNumberOfOutputs(); i++)
-      charCount = max(
-        charCount,
-        (int)mSourceEntity.getPortName(mSourceEntity.getNumberOfInputs() + i)
-          .length());
-
-    portWidth = calcTextWidth(charCount, fontSize);
-    entityWidth =
-      calcTextWidth(mSourceEntity.getEntityName().length(), entity_fontSize);
-
-    // Set entityWidth and portWidth to required size
-    if (2 * portWidth > entityWidth)
-      // 2*portWidth is greater than the entity name
-      entityWidth = 2 * portWidth;
-    else
-      // Width of entity Name is greater than 2*portWidth
-      portWidth = 0.5 * entityWidth;
-  } else {
-    // Use the given port width property from config file
-    entityWidth = fixedWidth;
-    portWidth = entityWidth / 2;
-  }
-
-  // Calculate height and width of the generic box
-  if (mSourceEntity.getNumberOfGenerics() > 0) {
-    // Get longest generic name
-    int charCount = 0;
-    for (int i = 0; i < mSourceEntity.getNumberOfGenerics(); i++)
-      charCount = max(charCount, (int)mSourceEntity.getGenericStr(i).length());
-
-    // genericWidth = floor(charCount*(generics_fontSize*0.03527)*0.7);
-    genericWidth = calcTextWidth(charCount, generics_fontSize);
-
-    genericHeight = mSourceEntity.getNumberOfGenerics() * 0.5;
-    // if (genericHeight <= 1.0)
-    // genericHeight = ;
-  }
-
-  // Get the longest vector length string	on the left side
-  for (int i = 0; i < mSourceEntity.getNumberOfInputs(); i++) {
-    if (mSourceEntity.isVector(i))
-      vectorTextLenghtIn =
-        max(vectorTextLenghtIn,
-            calcTextWidth(mSourceEntity.getVectorStr(i).length(), fontSize));
-  }
-  // If no vector length string is longer than the connector line itself it is
-  // set to 1.0
-  if (vectorTextLenghtIn < 1.0)
-    vectorTextLenghtIn = 1;
-
-  // Get the longest vector length string	on the right side
-  for (int i = 0; i < mSourceEntity.getNumberOfOutputs(); i++) {
-    if (mSourceEntity.isVector(mSourceEntity.getNumberOfInputs() + i))
-      vectorTextLenghtOut =
-        max(vectorTextLenghtOut,
-            calcTextWidth(
-              mSourceEntity.getVectorStr(mSourceEntity.getNumberOfInputs() + i)
-                .length(),
-              fontSize));
-  }
+    << "SVG::SVG(const VHDLEntity& sourceEntity, DrawingWriter& writer)";
 
-  // If no vector length string is longer than the connector line itself, it is
-  // set to 1.0
-  if (vectorTextLenghtOut < 1.0)
-    vectorTextLenghtOut = 1.0;
-
-  // Calculate origins of the drawing. These coordinates are used for glue
-  // points Half the group height
-  originY = groupHeight / 2;
-
-  // Two connectors on each side + rectangle width
-  groupWidth = (2 + entityWidth);
-  originX = groupWidth / 2;
+  translate(writer);
 }
 
 void
-SVG::translate()
+SVG::translate(DrawingWriter& mWriter)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "SVG::translate()";
 
+  // Dimensions of the symbol computed by the LayoutEngine
+  const double entityHeight = mLayout.entityHeight;
+  const double entityWidth = mLayout.entityWidth;
+  const double portWidth = mLayout.portWidth;
+  const double genericWidth = mLayout.genericWidth;
+  const double genericHeight = mLayout.genericHeight;
+  const double vectorTextLengthIn = mLayout.vectorTextLengthIn;
+  const double vectorTextLengthOut = mLayout.vectorTextLengthOut;
+  const double horizontal_Margin = mSettings.horizontalMargin;
+  const double vertical_Margin = mSettings.verticalMargin;
+  int clockPort = -1;
+  int resetPort = -1;
+
   double currentX = 0;
   double currentY = 0;
-  double strokeWidth = cfg.getDouble("entity.strokeWidth");
+  double strokeWidth = mSettings.entityShape.strokeWidthValue;
 
   stringstream ss;
-  SVGWriter mWriter(mOutputFile);
 
   // Insert SVG header and styles
   if (genericWidth > 0) {
     // Entity has generics
-    if (vectorTextLenghtOut > genericWidth) {
+    if (vectorTextLengthOut > genericWidth) {
       // One of the vector length strings is greater than the width of the
       // generic box
       if (mSourceEntity.getResetPort() != -1)
         // Entity has a reset port
-        mWriter.SVGHeader(entityWidth + 2 * horizontal_Margin +
-                            vectorTextLenghtIn + vectorTextLenghtOut,
+        mWriter.header(entityWidth + 2 * horizontal_Margin +
+                            vectorTextLengthIn + vectorTextLengthOut,
                           entityHeight + 1 + genericHeight +
                             2 * vertical_Margin);
       else
         // Entity has no reset port
-        mWriter.SVGHeader(entityWidth + 2 * horizontal_Margin +
-                            vectorTextLenghtIn + vectorTextLenghtOut,
+        mWriter.header(entityWidth + 2 * horizontal_Margin +
+                            vectorTextLengthIn + vectorTextLengthOut,
                           entityHeight + genericHeight + 2 * vertical_Margin);
     } else {
       // Vector length strings are all shorter than than the width of the
       // generic box
       if (mSourceEntity.getResetPort() != -1) {
         // Entity has a reset port
-        mWriter.SVGHeader(entityWidth + 2 * horizontal_Margin +
-                            vectorTextLenghtIn + genericWidth,
+        mWriter.header(entityWidth + 2 * horizontal_Margin +
+                            vectorTextLengthIn + genericWidth,
                           entityHeight + 1 + genericHeight +
                             2 * vertical_Margin);
       } else {
         // Entity has no reset port
-        mWriter.SVGHeader(entityWidth + 2 * horizontal_Margin +
-                            vectorTextLenghtIn + genericWidth,
+        mWriter.header(entityWidth + 2 * horizontal_Margin +
+                            vectorTextLengthIn + genericWidth,
                           entityHeight + genericHeight + 2 * vertical_Margin);
       }
     }
@@ -251,18 +121,18 @@ SVG::translate()
     // Entity has no generics
     if (mSourceEntity.getResetPort() != -1)
       // Entity has a reset port
-      mWriter.SVGHeader(entityWidth + 2 * horizontal_Margin +
-                          vectorTextLenghtIn + vectorTextLenghtOut,
+      mWriter.header(entityWidth + 2 * horizontal_Margin +
+                          vectorTextLengthIn + vectorTextLengthOut,
                         entityHeight + 2 + 2 * vertical_Margin);
     else
       // Entity has no reset port
-      mWriter.SVGHeader(entityWidth + 2 * horizontal_Margin +
-                          vectorTextLenghtIn + vectorTextLenghtOut,
+      mWriter.header(entityWidth + 2 * horizontal_Margin +
+                          vectorTextLengthIn + vectorTextLengthOut,
                         entityHeight + 1 + 2 * vertical_Margin);
   }
 
   // Set coordinate to the upper left corner of the label box
-  currentX = horizontal_Margin + vectorTextLenghtIn;
+  currentX = horizontal_Margin + vectorTextLengthIn;
   currentY = vertical_Margin;
 
   // Check if entity has generics
@@ -510,25 +380,5 @@ SVG::translate()
   mWriter.group(true);
 
   // Insert closing tags
-  mWriter.SVGFooter();
-}
-
-double
-SVG::calcTextWidth(int charCount, double fontSize)
-{
-  double yOffset = 0.52;
-  double lengthCoeff = 0.0232;
-  double lengthOffset = 0.0069;
-  double adjFactor = 0.95;
-
-  if (charCount == 0)
-    return 0;
-
-  double width =
-    ((lengthCoeff * charCount + lengthOffset) * fontSize + yOffset) * adjFactor;
-
-  if (width < 1.0)
-    return 1.0;
-  else
-    return width;
+  mWriter.footer();
 }
@@ -30,41 +30,28 @@
 
 #ifndef SVG_H
 #define SVG_H
+#include "DrawingWriter.h"
+#include "LayoutEngine.h"
 #include "OFileHandler.h"
 #include "VHDLEntity.h"
 
 class SVG : OFileHandler
 {
 private:
-  void initValues();
-  void translate();
-  double calcTextWidth(int charCount, double fontSize);
+  void translate(DrawingWriter& mWriter);
 
-  double entityHeight;
-  double entityWidth;
-  double groupHeight;
-  double groupWidth;
-  double originX;
-  double originY;
-  double portWidth;
-  double genericWidth;
-  double genericHeight;
-  double fontSize;
-  double generics_fontSize;
-  double entity_fontSize;
-  double fixedWidth;
-  std::string clockName;
-  std::string resetName;
-  int clockPort;
-  int resetPort;
-  //	std::string default_label;
-  double horizontal_Margin;
-  double vertical_Margin;
-  double vectorTextLenghtIn;
-  double vectorTextLenghtOut;
+  const Layout& mLayout;
 
 public:
-  SVG(VHDLEntity sourceEntity);
+  // Renders sourceEntity with the given layout into os
+  SVG(const VHDLEntity& sourceEntity, const Layout& layout, std::ostream& os);
+
+  // Draws sourceEntity with the given writer, e.g. to rasterize the symbol.
+  // Output of the writer goes to os
+  SVG(const VHDLEntity& sourceEntity,
+      const Layout& layout,
+      std::ostream& os,
+      DrawingWriter& writer);
 };
 
 #endif
\ No newline at end of file
@@ -40,6 +40,7 @@
 
 SVGWriter::SVGWriter(std::ostream& os)
   : os(os)
+  , mSettings(cfg.getSnapshot())
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "SVGWriter::SVGWriter(ostream& os)";
@@ -54,9 +55,9 @@ void
 SVGWriter::group(bool close)
 {
   if (close)
-    os << "</g>" << std::endl;
+    os << "</g>" << '\n';
   else
-    os << "<g>" << std::endl;
+    os << "<g>" << '\n';
 
   return;
 }
@@ -71,7 +72,7 @@ SVGWriter::line(double x1,
   // <line class="connector" x1="0cm" y1="0cm" x2="20cm" y2="5cm" />
 
   os << "<line class=\"" << CSSclass << "\" x1=\"" << x1 << "cm\" y1=\"" << y1
-     << "cm\" x2=\"" << x2 << "cm\" y2=\"" << y2 << "cm\" />" << std::endl;
+     << "cm\" x2=\"" << x2 << "cm\" y2=\"" << y2 << "cm\" />" << '\n';
 
   return;
 }
@@ -87,7 +88,7 @@ SVGWriter::rect(double x,
 
   os << "<rect class=\"" << CSSclass << "\" x=\"" << x << "cm\" y=\"" << y
      << "cm\" width=\"" << width << "cm\" height=\"" << height << "cm\" />"
-     << std::endl;
+     << '\n';
 
   return;
 }
@@ -98,7 +99,7 @@ SVGWriter::circle(double x, double y, double radius, std::string CSSclass)
   // <circle class="connector" cx="50" cy="50" r="40" />
 
   os << "<circle class=\"" << CSSclass << "\" cx=\"" << x << "cm\" cy=\"" << y
-     << "cm\" r=\"" << radius << "cm\" />" << std::endl;
+     << "cm\" r=\"" << radius << "cm\" />" << '\n';
 
   return;
 }
@@ -109,17 +110,17 @@ SVGWriter::text(double x, double y, std::string text, std::string CSSclass)
   // <text class="label center" x="0" y="15">cntdnmodm_rtl</text>
 
   os << "<text class=\"" << CSSclass << "\" x=\"" << x << "cm\" y=\"" << y
-     << "cm\" >" << text << "</text>" << std::endl;
+     << "cm\" >" << text << "</text>" << '\n';
 
   return;
 }
 
 void
-SVGWriter::SVGHeader(double width, double height)
+SVGWriter::header(double width, double height)
 {
   os << "<svg xmlns=\"http://www.w3.org/2000/svg\" "
         "xmlns:xlink=\"http://www.w3.org/1999/xlink\" width=\""
-     << width << "cm\" height=\"" << height << "cm\">" << std::endl;
+     << width << "cm\" height=\"" << height << "cm\">" << '\n';
 
   SVGStyles();
 
@@ -127,9 +128,9 @@ SVGWriter::SVGHeader(double width, double height)
 }
 
 void
-SVGWriter::SVGFooter()
+SVGWriter::footer()
 {
-  os << "</svg>" << std::endl;
+  os << "</svg>" << '\n';
 
   return;
 }
@@ -137,166 +138,166 @@ SVGWriter::SVGFooter()
 void
 SVGWriter::SVGStyles()
 {
-  os << "<style type=\"text/css\" >" << std::endl << "\t<![CDATA[" << std::endl;
+  os << "<style type=\"text/css\" >" << '\n' << "\t<![CDATA[" << '\n';
 
   // Text styles
-  os << "\t/* Text styles */" << std::endl;
+  os << "\t/* Text styles */" << '\n';
 
   // Label
-  os << "\t.label {" << std::endl
-     << "\t\tfont-family: " << cfg.getString("label.fontFamily") << ";"
-     << std::endl
-     << "\t\tfont-size: " << cfg.getString("label.fontSize") << ";" << std::endl
-     << "\t\tfont-weight: " << cfg.getString("label.fontWeight") << ";"
-     << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.label {" << '\n'
+     << "\t\tfont-family: " << mSettings.labelFont.family << ";"
+     << '\n'
+     << "\t\tfont-size: " << mSettings.labelFont.size << ";" << '\n'
+     << "\t\tfont-weight: " << mSettings.labelFont.weight << ";"
+     << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Entity
-  os << "\t.entity {" << std::endl
-     << "\t\tfont-family: " << cfg.getString("entity.fontFamily") << ";"
-     << std::endl
-     << "\t\tfont-size: " << cfg.getString("entity.fontSize") << ";"
-     << std::endl
-     << "\t\tfont-weight: " << cfg.getString("entity.fontWeight") << ";"
-     << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.entity {" << '\n'
+     << "\t\tfont-family: " << mSettings.entityFont.family << ";"
+     << '\n'
+     << "\t\tfont-size: " << mSettings.entityFont.size << ";"
+     << '\n'
+     << "\t\tfont-weight: " << mSettings.entityFont.weight << ";"
+     << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Port name
-  os << "\t.port {" << std::endl
-     << "\t\tfont-family: " << cfg.getString("port.fontFamily") << ";"
-     << std::endl
-     << "\t\tfont-size: " << cfg.getString("port.fontSize") << ";" << std::endl
-     << "\t\tfont-weight: " << cfg.getString("port.fontWeight") << ";"
-     << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.port {" << '\n'
+     << "\t\tfont-family: " << mSettings.portFont.family << ";"
+     << '\n'
+     << "\t\tfont-size: " << mSettings.portFont.size << ";" << '\n'
+     << "\t\tfont-weight: " << mSettings.portFont.weight << ";"
+     << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Vectors
-  os << "\t.vector {" << std::endl
-     << "\t\tfont-family: " << cfg.getString("vector.fontFamily") << ";"
-     << std::endl
-     << "\t\tfont-size: " << cfg.getString("vector.fontSize") << ";"
-     << std::endl
-     << "\t\tfont-weight: " << cfg.getString("vector.fontWeight") << ";"
-     << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.vector {" << '\n'
+     << "\t\tfont-family: " << mSettings.vectorFont.family << ";"
+     << '\n'
+     << "\t\tfont-size: " << mSettings.vectorFont.size << ";"
+     << '\n'
+     << "\t\tfont-weight: " << mSettings.vectorFont.weight << ";"
+     << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Generics
-  os << "\t.generics {" << std::endl
-     << "\t\tfont-family: " << cfg.getString("genericSignal.fontFamily") << ";"
-     << std::endl
-     << "\t\tfont-size: " << cfg.getString("genericSignal.fontSize") << ";"
-     << std::endl
-     << "\t\tfont-weight: " << cfg.getString("genericSignal.fontWeight") << ";"
-     << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.generics {" << '\n'
+     << "\t\tfont-family: " << mSettings.genericSignalFont.family << ";"
+     << '\n'
+     << "\t\tfont-size: " << mSettings.genericSignalFont.size << ";"
+     << '\n'
+     << "\t\tfont-weight: " << mSettings.genericSignalFont.weight << ";"
+     << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Text alignment
-  os << "\t/* Text alignment */" << std::endl;
+  os << "\t/* Text alignment */" << '\n';
 
   // Output port (right side)
-  os << "\t.right {" << std::endl
-     << "\t\tdominant-baseline: central;" << std::endl
-     << "\t\ttext-anchor: end;" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.right {" << '\n'
+     << "\t\tdominant-baseline: central;" << '\n'
+     << "\t\ttext-anchor: end;" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Input port (left side)
-  os << "\t.left {" << std::endl
-     << "\t\tdominant-baseline: central;" << std::endl
-     << "\t\ttext-anchor: start;" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.left {" << '\n'
+     << "\t\tdominant-baseline: central;" << '\n'
+     << "\t\ttext-anchor: start;" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Center port
-  os << "\t.center {" << std::endl
-     << "\t\tdominant-baseline: central;" << std::endl
-     << "\t\ttext-anchor: middle;" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.center {" << '\n'
+     << "\t\tdominant-baseline: central;" << '\n'
+     << "\t\ttext-anchor: middle;" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Shape styles
-  os << "\t/* Shape styles */" << std::endl;
+  os << "\t/* Shape styles */" << '\n';
 
   // Entity box
-  os << "\t.entityBox {" << std::endl
-     << "\t\tstroke-width: " << cfg.getString("entity.strokeWidth") << ";"
-     << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("entity.stroke") << ";" << std::endl
-     << "\t\tstroke: " << cfg.getString("entity.strokeColor") << ";"
-     << std::endl
-     //	<< "\t\tfill: " << cfg.getString("entity.fill") << ";" << std::endl
-     << "\t\tfill: " << cfg.getString("entity.fillColor") << ";" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.entityBox {" << '\n'
+     << "\t\tstroke-width: " << mSettings.entityShape.strokeWidth << ";"
+     << '\n'
+     //	<< "\t\tstroke: " << mSettings.entityShape.stroke << ";" << '\n'
+     << "\t\tstroke: " << mSettings.entityShape.strokeColor << ";"
+     << '\n'
+     //	<< "\t\tfill: " << mSettings.entityShape.fill << ";" << '\n'
+     << "\t\tfill: " << mSettings.entityShape.fillColor << ";" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Port box
-  os << "\t.portBox {" << std::endl
-     << "\t\tstroke-width: " << cfg.getString("port.strokeWidth") << ";"
-     << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("port.stroke") << ";" << std::endl
-     << "\t\tstroke: " << cfg.getString("port.strokeColor") << ";"
-     << std::endl
-     //	<< "\t\tfill: " << cfg.getString("port.fill") << ";" << std::endl
-     << "\t\tfill: " << cfg.getString("port.fillColor") << ";" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.portBox {" << '\n'
+     << "\t\tstroke-width: " << mSettings.portShape.strokeWidth << ";"
+     << '\n'
+     //	<< "\t\tstroke: " << mSettings.portShape.stroke << ";" << '\n'
+     << "\t\tstroke: " << mSettings.portShape.strokeColor << ";"
+     << '\n'
+     //	<< "\t\tfill: " << mSettings.portShape.fill << ";" << '\n'
+     << "\t\tfill: " << mSettings.portShape.fillColor << ";" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Label box
-  os << "\t.labelBox {" << std::endl
-     << "\t\tstroke-width: " << cfg.getString("label.strokeWidth") << ";"
-     << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("label.stroke") << ";" << std::endl
-     << "\t\tstroke: " << cfg.getString("label.strokeColor") << ";"
-     << std::endl
-     //	<< "\t\tfill: " << cfg.getString("label.fill") << ";" << std::endl
-     << "\t\tfill: " << cfg.getString("label.fillColor") << ";" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.labelBox {" << '\n'
+     << "\t\tstroke-width: " << mSettings.labelShape.strokeWidth << ";"
+     << '\n'
+     //	<< "\t\tstroke: " << mSettings.labelShape.stroke << ";" << '\n'
+     << "\t\tstroke: " << mSettings.labelShape.strokeColor << ";"
+     << '\n'
+     //	<< "\t\tfill: " << mSettings.labelShape.fill << ";" << '\n'
+     << "\t\tfill: " << mSettings.labelShape.fillColor << ";" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // VectorLength box
-  os << "\t.vectorLength {" << std::endl
-     << "\t\tstroke-width: " << cfg.getString("label.strokeWidth") << ";"
-     << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("label.stroke") << ";" << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("label.strokeColor") << ";" <<
-     // std::endl
-     //	<< "\t\tfill: " << cfg.getString("label.fill") << ";" << std::endl
-     << "\t\tfill: " << cfg.getString("label.fillColor") << ";" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.vectorLength {" << '\n'
+     << "\t\tstroke-width: " << mSettings.labelShape.strokeWidth << ";"
+     << '\n'
+     //	<< "\t\tstroke: " << mSettings.labelShape.stroke << ";" << '\n'
+     //	<< "\t\tstroke: " << mSettings.labelShape.strokeColor << ";" <<
+     // '\n'
+     //	<< "\t\tfill: " << mSettings.labelShape.fill << ";" << '\n'
+     << "\t\tfill: " << mSettings.labelShape.fillColor << ";" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Generic box
-  os << "\t.genericsBox {" << std::endl
-     << "\t\tstroke-width: " << cfg.getString("generics.strokeWidth") << ";"
-     << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("generics.stroke") << ";" <<
-     // std::endl
-     << "\t\tstroke: " << cfg.getString("generics.strokeColor") << ";"
-     << std::endl
-     //	<< "\t\tfill: " << cfg.getString("generics.fill") << ";" << std::endl
-     << "\t\tfill: " << cfg.getString("generics.fillColor") << ";" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
+  os << "\t.genericsBox {" << '\n'
+     << "\t\tstroke-width: " << mSettings.genericsShape.strokeWidth << ";"
+     << '\n'
+     //	<< "\t\tstroke: " << mSettings.genericsShape.stroke << ";" <<
+     // '\n'
+     << "\t\tstroke: " << mSettings.genericsShape.strokeColor << ";"
+     << '\n'
+     //	<< "\t\tfill: " << mSettings.genericsShape.fill << ";" << '\n'
+     << "\t\tfill: " << mSettings.genericsShape.fillColor << ";" << '\n'
+     << "\t}" << '\n'
+     << '\n';
 
   // Connector
-  os << "\t.connector {" << std::endl
-     << "\t\tstroke-width: " << cfg.getString("connector.strokeWidth") << ";"
-     << std::endl
-     //	<< "\t\tstroke: " << cfg.getString("connector.stroke") << ";" <<
-     // std::endl
-     << "\t\tstroke: " << cfg.getString("connector.strokeColor") << ";"
-     << std::endl
-     //	<< "\t\tfill: " << cfg.getString("connector.fill") << ";" << std::endl
-     << "\t\tfill: " << cfg.getString("connector.fillColor") << ";" << std::endl
-     << "\t}" << std::endl
-     << std::endl;
-
-  os << "\t]]>" << std::endl << "</style>" << std::endl;
+  os << "\t.connector {" << '\n'
+     << "\t\tstroke-width: " << mSettings.connectorShape.strokeWidth << ";"
+     << '\n'
+     //	<< "\t\tstroke: " << mSettings.connectorShape.stroke << ";" <<
+     // '\n'
+     << "\t\tstroke: " << mSettings.connectorShape.strokeColor << ";"
+     << '\n'
+     //	<< "\t\tfill: " << mSettings.connectorShape.fill << ";" << '\n'
+     << "\t\tfill: " << mSettings.connectorShape.fillColor << ";" << '\n'
+     << "\t}" << '\n'
+     << '\n';
+
+  os << "\t]]>" << '\n' << "</style>" << '\n';
 
   return;
 }
@@ -31,6 +31,9 @@
 #ifndef SVGWRITER_H
 #define SVGWRITER_H
 
+#include "Config.h"
+#include "DrawingWriter.h"
+
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -38,7 +41,7 @@
 #include <stack>
 #include <string>
 
-class SVGWriter
+class SVGWriter : public DrawingWriter
 {
 public:
   // Creates an SVGWriter object with passed ostream reference as output
@@ -48,37 +51,49 @@ public:
 
   // Writes the SVG header to the output file. If width and height are given the
   // produced svg file will have these dimensions
-  void SVGHeader(double width, double height);
+  void header(double width, double height) override;
 
   // Writes the SVG footer section
-  void SVGFooter();
+  void footer() override;
 
   // Writes the required SVG styles to the output file
   void SVGStyles();
 
   // Writes a group tag to the output file
-  void group(bool close = false);
+  void group(bool close = false) override;
 
   // Write a line tag with given data
-  void line(double x1, double y1, double x2, double y2, std::string CSSclass);
+  void line(double x1,
+            double y1,
+            double x2,
+            double y2,
+            std::string CSSclass) override;
 
   // Write a line tag with given data
   void rect(double x,
             double y,
             double width,
             double height,
-            std::string CSSclass);
+            std::string CSSclass) override;
 
   // Write circle tag with given data
-  void circle(double x, double y, double diameter, std::string CSSclass);
+  void circle(double x,
+              double y,
+              double diameter,
+              std::string CSSclass) override;
 
   // Places a string as a text object at given location
-  void text(double x, double y, std::string text, std::string CSSclass);
+  void text(double x,
+            double y,
+            std::string text,
+            std::string CSSclass) override;
 
 private:
   std::ostream& os;
+
+  // Typed config values for styles
+  const ConfigSnapshot& mSettings;
   int gluePointID;
-  void header();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,409 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Server.cpp
+*	Author: Benjamin Wießneth
+*	Description: Serves render requests on a Unix domain socket
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "Server.h"
+#include "Config.h"
+#include "MSG.h"
+
+#ifndef _WIN32
+
+#include "OutputGenerator.h"
+#include "SourceFile.h"
+#include "ThreadPool.h"
+#include "VHDLParser.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Requests larger than this are rejected
+static const size_t MAX_REQUEST_SIZE = 16 * 1024 * 1024;
+
+// Time a client has to send its whole request, so clients which never shut
+// down their side can't block a worker
+static const int REQUEST_TIMEOUT_MS = 10000;
+
+// Number of connections waiting to be accepted
+static const int LISTEN_BACKLOG = 64;
+
+// Format names of RENDER requests and the extension of the rendered files
+struct FormatName
+{
+  const char* name;
+  OutputGenerator::FORMAT format;
+  const char* extension;
+};
+
+static const FormatName formatNames[] = {
+  { "fodg", OutputGenerator::FORMAT::FODG, "fodg" },
+  { "svg", OutputGenerator::FORMAT::SVG, "svg" },
+  { "png", OutputGenerator::FORMAT::PNG, "png" },
+  { "dokuwiki", OutputGenerator::FORMAT::DokuWiki, "txt" },
+  { "markdown", OutputGenerator::FORMAT::Markdown, "md" },
+  { "latex", OutputGenerator::FORMAT::LaTeX, "tex" }
+};
+
+// Request and latency counters
+static std::atomic<unsigned long long> requestCount(0);
+static std::atomic<unsigned long long> failedCount(0);
+static std::atomic<unsigned long long> totalMicroseconds(0);
+static std::atomic<unsigned long long> maxMicroseconds(0);
+
+// Returns an error response
+static std::string
+getErrorResponse(const std::string& message)
+{
+  return "ERROR " + message + "\n";
+}
+
+// Returns the counters of all finished requests
+static std::string
+getStatsResponse()
+{
+  unsigned long long requests = requestCount;
+  std::ostringstream response;
+  response << "OK\n"
+           << "requests=" << requests << "\n"
+           << "failed=" << failedCount << "\n"
+           << "average_us=" << (requests ? totalMicroseconds / requests : 0)
+           << "\n"
+           << "max_us=" << maxMicroseconds << "\n";
+  return response.str();
+}
+
+// Returns the next line of request starting at pos without line break and
+// moves pos behind it
+static std::string_view
+getLine(std::string_view request, size_t& pos)
+{
+  size_t end = request.find('\n', pos);
+  if (end == std::string_view::npos)
+    end = request.size();
+
+  std::string_view line = request.substr(pos, end - pos);
+  pos = std::min(end + 1, request.size());
+
+  if (!line.empty() && (line.back() == '\r'))
+    line.remove_suffix(1);
+  return line;
+}
+
+// Parses the source and renders its entities in all formats. Uses the config
+// snapshot of the calling thread
+static std::string
+renderEntities(const std::vector<const FormatName*>& formats,
+               const std::string& label,
+               const std::string& path,
+               std::string_view source)
+{
+  // Source files are read like on the command line
+  SourceFile sourceFile;
+  if (!path.empty()) {
+    if (!sourceFile.open(path))
+      return getErrorResponse("Can't open source file " + path);
+    source = sourceFile.getView();
+  }
+
+  VHDLParser parser("");
+  parser.parseBuffer(source);
+  parser.setEntityLabel(label);
+
+  // Entities without ports are skipped like in convertFile()
+  std::ostringstream files;
+  unsigned int numberOfFiles = 0;
+  for (const VHDLEntity& entity : parser.getEntities()) {
+    if ((entity.getNumberOfInputs() == 0) &&
+        (entity.getNumberOfOutputs() == 0))
+      continue;
+
+    for (const FormatName* format : formats) {
+      std::string content = OutputGenerator::render(format->format, entity);
+      files << entity.getEntityName() << "." << format->extension << " "
+            << content.size() << "\n"
+            << content;
+      numberOfFiles++;
+    }
+  }
+
+  if (numberOfFiles == 0)
+    return getErrorResponse("Parsed VHDL entity has no valid ports.");
+
+  return "OK " + std::to_string(numberOfFiles) + "\n" + files.str();
+}
+
+// Handles a single request and returns the response
+static std::string
+handleRequest(std::string_view request)
+{
+  size_t pos = 0;
+  std::string_view command = getLine(request, pos);
+
+  if (command == "STATS")
+    return getStatsResponse();
+  if (command.compare(0, 7, "RENDER ") != 0)
+    return getErrorResponse("Unknown command");
+
+  // Comma separated list of formats
+  std::vector<const FormatName*> formats;
+  std::string_view formatList = command.substr(7);
+  while (!formatList.empty()) {
+    size_t comma = std::min(formatList.find(','), formatList.size());
+    std::string_view name = formatList.substr(0, comma);
+    formatList.remove_prefix(std::min(comma + 1, formatList.size()));
+
+    const FormatName* found = nullptr;
+    for (const FormatName& format : formatNames)
+      if (name == format.name)
+        found = &format;
+    if (found == nullptr)
+      return getErrorResponse("Unknown format '" + std::string(name) + "'");
+    formats.push_back(found);
+  }
+  if (formats.empty())
+    return getErrorResponse("No format requested");
+
+  // Options end with an empty line
+  std::string path;
+  std::map<std::string, std::string> values;
+  while (pos < request.size()) {
+    std::string_view line = getLine(request, pos);
+    if (line.empty())
+      break;
+
+    size_t equal = line.find('=');
+    if (equal == std::string_view::npos)
+      return getErrorResponse("Invalid option '" + std::string(line) + "'");
+
+    std::string key(line.substr(0, equal));
+    std::string value(line.substr(equal + 1));
+    if (key == "path")
+      path = value;
+    else if (key == "label")
+      values["default_label"] = value;
+    else if (cfg.hasKey(key) && (key.compare(0, 4, "VEC.") != 0) &&
+             (key.compare(0, 5, "PATH.") != 0))
+      values[key] = value;
+    else
+      return getErrorResponse("Unknown key '" + key + "'");
+  }
+
+  // Requests without options use the global config
+  std::unique_ptr<Config> requestConfig;
+  if (!values.empty())
+    requestConfig.reset(new Config(cfg, values));
+  Config& config = requestConfig ? *requestConfig : cfg;
+
+  Config::setThreadSnapshot(&config.getSnapshot());
+  MSG::setSourceFile(path);
+  std::string response = renderEntities(
+    formats, config.getString("default_label"), path, request.substr(pos));
+  MSG::setSourceFile();
+  Config::setThreadSnapshot();
+
+  return response;
+}
+
+// Reads the request from the client until it shuts down its side. Returns
+// an error message if the request can't be read completely
+static std::string
+readRequest(int fd, std::string& request)
+{
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(REQUEST_TIMEOUT_MS);
+  char buffer[65536];
+  while (true) {
+    long long remaining =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now())
+        .count();
+    if (remaining <= 0)
+      return "Request timed out";
+
+    pollfd client = { fd, POLLIN, 0 };
+    int ready = poll(&client, 1, (int)remaining);
+    if (ready == 0)
+      return "Request timed out";
+    if (ready < 0) {
+      if (errno == EINTR)
+        continue;
+      return "Can't read request";
+    }
+
+    ssize_t length = read(fd, buffer, sizeof(buffer));
+    if (length == 0)
+      return "";
+    if (length < 0) {
+      if (errno == EINTR)
+        continue;
+      return "Can't read request";
+    }
+
+    request.append(buffer, length);
+    if (request.size() > MAX_REQUEST_SIZE)
+      return "Request too large";
+  }
+}
+
+// Sends the whole response. Clients which disconnected early are ignored
+static void
+sendResponse(int fd, const std::string& response)
+{
+  size_t sent = 0;
+  while (sent < response.size()) {
+    ssize_t length =
+      send(fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+    if (length < 0) {
+      if (errno == EINTR)
+        continue;
+      return;
+    }
+    sent += length;
+  }
+}
+
+// Serves a single connection and updates the counters
+static void
+serveClient(int fd)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  // Messages of the parser and generators are printed in one piece
+  std::ostringstream output;
+  MSG::setThreadStream(&output);
+
+  std::string request;
+  std::string response;
+  std::string error = readRequest(fd, request);
+  if (error.empty())
+    response = handleRequest(request);
+  else
+    response = getErrorResponse(error);
+
+  MSG::setThreadStream();
+
+  sendResponse(fd, response);
+  close(fd);
+
+  unsigned long long duration =
+    std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start)
+      .count();
+  requestCount++;
+  if (response.compare(0, 6, "ERROR ") == 0)
+    failedCount++;
+  totalMicroseconds += duration;
+  unsigned long long maximum = maxMicroseconds;
+  while ((duration > maximum) &&
+         !maxMicroseconds.compare_exchange_weak(maximum, duration))
+    ;
+
+  if (output.tellp() > 0)
+    MSG::getStream() << output.str() << std::flush;
+}
+
+// Serves render requests on the socket
+int
+runServer(const std::string& socketPath, unsigned int jobs)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "runServer(" << socketPath << ", " << jobs << " jobs)";
+
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (socketPath.size() >= sizeof(address.sun_path)) {
+    MSG(LOG_LEVEL::ERROR) << "Socket path " << socketPath << " is too long";
+    return 1;
+  }
+  socketPath.copy(address.sun_path, socketPath.size());
+
+  int server = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (server < 0) {
+    MSG(LOG_LEVEL::ERROR) << "Can't create socket: " << strerror(errno);
+    return 1;
+  }
+
+  // A socket left behind by a previous server is replaced
+  struct stat status;
+  if ((stat(socketPath.c_str(), &status) == 0) && S_ISSOCK(status.st_mode))
+    unlink(socketPath.c_str());
+
+  if ((bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) !=
+       0) ||
+      (listen(server, LISTEN_BACKLOG) != 0)) {
+    MSG(LOG_LEVEL::ERROR) << "Can't listen on " << socketPath << ": "
+                          << strerror(errno);
+    close(server);
+    return 1;
+  }
+
+  ThreadPool pool(jobs);
+  MSG::getStream() << "Listening on " << socketPath << " using "
+                   << pool.getNumberOfThreads() << " jobs" << std::endl;
+
+  while (true) {
+    int client = accept4(server, nullptr, nullptr, SOCK_CLOEXEC);
+    if (client < 0) {
+      if ((errno == EINTR) || (errno == ECONNABORTED))
+        continue;
+      MSG(LOG_LEVEL::ERROR) << "Can't accept connection: " << strerror(errno);
+      break;
+    }
+    pool.submit([client] { serveClient(client); });
+  }
+
+  close(server);
+  unlink(socketPath.c_str());
+  return 1;
+}
+
+#else
+
+// Serves render requests on the socket
+int
+runServer(const std::string& socketPath, unsigned int jobs)
+{
+  MSG(LOG_LEVEL::ERROR) << "The server mode isn't supported on this platform";
+  return 1;
+}
+
+#endif
@@ -0,0 +1,63 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Server.h
+*	Author: Benjamin Wießneth
+*	Description: Serves render requests on a Unix domain socket
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <string>
+
+// Serves render requests on the Unix domain socket at socketPath until the
+// process is terminated. Requests are handled concurrently by a pool of jobs
+// worker threads. The config is loaded once and entities are rendered in
+// memory, nothing is written to disk.
+//
+// Each connection carries a single request, which ends when the client shuts
+// down its side of the connection. A request starts with a command line:
+//
+//   RENDER <formats>   Renders the entities of a VHDL source in the comma
+//                      separated formats fodg, svg, png, dokuwiki, markdown
+//                      and latex
+//   STATS              Returns the request and latency counters
+//
+// RENDER is followed by optional "key=value" lines and an empty line. The key
+// "path" names a source file to read, otherwise the rest of the request is
+// the VHDL source. "label" sets the entity label and all other keys override
+// config values for this request only, e.g. "SVG.strokeColor=#000000".
+//
+// The response starts with "OK <n>" followed by n rendered files, each as a
+// "<file name> <size>" line and size bytes of content. STATS returns "OK"
+// followed by "key=value" lines. Failed requests return "ERROR <message>",
+// including requests larger than 16 MiB or not completely received within
+// 10 seconds.
+// Returns non-zero if the socket can't be created
+int
+runServer(const std::string& socketPath, unsigned int jobs);
+
+#endif
@@ -0,0 +1,232 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: SourceDiscovery.cpp
+*	Author: Benjamin Wießneth
+*	Description: Finds the source files of the given paths
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "SourceDiscovery.h"
+#include "MSG.h"
+#include "Stats.h"
+#include "tools.h"
+
+#include <algorithm>
+
+// Matches the rest of a glob pattern against the rest of a path
+static bool
+matchGlob(const char* pattern, const char* path)
+{
+  while (*pattern != '\0') {
+    if ((pattern[0] == '*') && (pattern[1] == '*')) {
+      pattern += 2;
+
+      // "**/" matches none or any number of whole directories
+      if (*pattern == '/') {
+        pattern++;
+        for (const char* c = path;; c++) {
+          if (((c == path) || (c[-1] == '/')) && matchGlob(pattern, c))
+            return true;
+          if (*c == '\0')
+            return false;
+        }
+      }
+
+      for (const char* c = path;; c++) {
+        if (matchGlob(pattern, c))
+          return true;
+        if (*c == '\0')
+          return false;
+      }
+    }
+
+    if (*pattern == '*') {
+      pattern++;
+      for (const char* c = path;; c++) {
+        if (matchGlob(pattern, c))
+          return true;
+        if ((*c == '\0') || (*c == '/'))
+          return false;
+      }
+    }
+
+    if ((*path == '\0') || ((*pattern == '?') ? (*path == '/')
+                                              : (*pattern != *path)))
+      return false;
+    pattern++;
+    path++;
+  }
+  return *path == '\0';
+}
+
+bool
+SourceDiscovery::matchPattern(const std::string& pattern,
+                              const std::string& path)
+{
+  if (pattern.find('/') != std::string::npos)
+    return matchGlob(pattern.c_str(), path.c_str());
+
+  size_t slash = path.find_last_of('/');
+  return matchGlob(pattern.c_str(),
+                   path.c_str() + (slash == std::string::npos ? 0 : slash + 1));
+}
+
+bool
+SourceDiscovery::matchAny(const std::vector<std::string>& patterns,
+                          const std::string& path)
+{
+  for (const std::string& pattern : patterns)
+    if (matchPattern(pattern, path))
+      return true;
+  return false;
+}
+
+std::vector<std::string>
+SourceDiscovery::splitPatterns(const std::string& list)
+{
+  std::vector<std::string> patterns;
+  size_t start = 0;
+  while (start < list.size()) {
+    size_t end = std::min(list.find(';', start), list.size());
+    if (end > start)
+      patterns.push_back(list.substr(start, end - start));
+    start = end + 1;
+  }
+  return patterns;
+}
+
+SourceDiscovery::SourceDiscovery(const std::vector<std::string>& paths,
+                                 const std::vector<std::string>& includes,
+                                 const std::vector<std::string>& excludes)
+  : mPaths(paths)
+  , mIncludes(includes)
+  , mExcludes(excludes)
+  , mNumberOfFiles(0)
+  , mDone(false)
+  , mStop(false)
+  , mThread(&SourceDiscovery::run, this)
+{}
+
+SourceDiscovery::~SourceDiscovery()
+{
+  mStop = true;
+  mThread.join();
+}
+
+bool
+SourceDiscovery::next(std::string& fileName)
+{
+  std::unique_lock<std::mutex> guard(mLock);
+  mFound.wait(guard, [this] { return !mFiles.empty() || mDone; });
+  if (mFiles.empty())
+    return false;
+
+  fileName = std::move(mFiles.front());
+  mFiles.pop_front();
+  return true;
+}
+
+void
+SourceDiscovery::push(const std::string& fileName)
+{
+  std::lock_guard<std::mutex> guard(mLock);
+  mFiles.push_back(fileName);
+  mNumberOfFiles++;
+  mFound.notify_one();
+}
+
+void
+SourceDiscovery::run()
+{
+  Stats::Timer timer(Stats::PHASE::DISCOVER);
+
+  for (const std::string& path : mPaths) {
+    if (mStop)
+      break;
+
+    // Everything else, including stdin and missing files, is passed on to
+    // the converter, which reports errors
+    std::error_code error;
+    if ((path == "-") || !std::filesystem::is_directory(path, error)) {
+      push(path);
+      continue;
+    }
+
+    unsigned int numberOfFiles = mNumberOfFiles;
+    searchDirectory(path, "");
+    if (numberOfFiles == mNumberOfFiles)
+      MSG(LOG_LEVEL::WARNING) << "No source files found in '" << path << "'";
+  }
+
+  std::lock_guard<std::mutex> guard(mLock);
+  mDone = true;
+  mFound.notify_all();
+}
+
+void
+SourceDiscovery::searchDirectory(const std::filesystem::path& directory,
+                                 const std::string& relative)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "SourceDiscovery::searchDirectory(" << directory.string() << ")";
+
+  std::vector<std::filesystem::directory_entry> entries;
+  std::error_code error;
+  std::filesystem::directory_iterator it(
+    directory, std::filesystem::directory_options::skip_permission_denied,
+    error);
+  for (; !error && (it != std::filesystem::directory_iterator());
+       it.increment(error))
+    entries.push_back(*it);
+
+  if (error) {
+    MSG(LOG_LEVEL::ERROR) << "Can't read directory '" << directory.string()
+                          << "': " << error.message();
+    return;
+  }
+
+  // The order of the directory entries depends on the file system
+  std::sort(entries.begin(), entries.end());
+
+  for (const std::filesystem::directory_entry& entry : entries) {
+    if (mStop)
+      return;
+
+    std::string name = entry.path().filename().string();
+    std::string path = relative.empty() ? name : relative + "/" + name;
+    if (matchAny(mExcludes, path))
+      continue;
+
+    // Linked directories aren't followed, so there are no loops
+    if (entry.is_directory(error)) {
+      if (!entry.is_symlink(error))
+        searchDirectory(entry.path(), path);
+    } else if (validFileExtension(name) &&
+               (mIncludes.empty() || matchAny(mIncludes, path))) {
+      // Other files would only be rejected by the converter
+      push(entry.path().string());
+    }
+  }
+}
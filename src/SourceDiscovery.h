@@ -0,0 +1,104 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: SourceDiscovery.h
+*	Author: Benjamin Wießneth
+*	Description: Finds the source files of the given paths
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef SOURCEDISCOVERY_H
+#define SOURCEDISCOVERY_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Finds the source files of the paths given on the command line in a
+// background thread, so the first files are converted while directories are
+// still being searched. Files are returned as they are, directories are
+// searched recursively. The files are returned in the order of paths, the
+// entries of each directory sorted by name
+class SourceDiscovery
+{
+public:
+  // Starts the search. A .vhd or .vhdl file within a directory is a source if
+  // it matches one of the include patterns (if there are any) and none of the
+  // exclude patterns. Subdirectories matching an exclude pattern are skipped
+  SourceDiscovery(const std::vector<std::string>& paths,
+                  const std::vector<std::string>& includes,
+                  const std::vector<std::string>& excludes);
+
+  // Stops the search and waits for the background thread
+  ~SourceDiscovery();
+
+  // Waits for the next source file. Returns false once all files were
+  // returned
+  bool next(std::string& fileName);
+
+  // Returns true if path matches the glob pattern. "*" and "?" don't match
+  // "/", "**" matches across directories. Patterns without "/" are matched
+  // against the last path component only, others against the whole path
+  static bool matchPattern(const std::string& pattern, const std::string& path);
+
+  // Returns true if path matches one of the patterns
+  static bool matchAny(const std::vector<std::string>& patterns,
+                       const std::string& path);
+
+  // Returns the patterns of a semicolon separated list, e.g. "VEC.include"
+  static std::vector<std::string> splitPatterns(const std::string& list);
+
+private:
+  // Main loop of the background thread
+  void run();
+
+  // Searches directory and its subdirectories. relative is the path of
+  // directory within the searched path, which is matched by the patterns
+  void searchDirectory(const std::filesystem::path& directory,
+                       const std::string& relative);
+
+  // Queues a found source file
+  void push(const std::string& fileName);
+
+  std::vector<std::string> mPaths;
+  std::vector<std::string> mIncludes;
+  std::vector<std::string> mExcludes;
+
+  // Found files which weren't returned yet
+  std::deque<std::string> mFiles;
+  std::mutex mLock;
+  std::condition_variable mFound;
+  unsigned int mNumberOfFiles;
+  bool mDone;
+
+  std::atomic<bool> mStop;
+  std::thread mThread;
+};
+
+#endif
@@ -0,0 +1,204 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: SourceFile.cpp
+*	Author: Benjamin Wießneth
+*	Description: Read-only view of a VHDL source file. Regular files are
+*	memory-mapped, stdin and pipes are read into a buffer
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "SourceFile.h"
+#include "MSG.h"
+
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SourceFile::SourceFile()
+  : mData(nullptr)
+  , mSize(0)
+  , mMapping(nullptr)
+  , mMappingSize(0)
+{}
+
+SourceFile::~SourceFile()
+{
+  close();
+}
+
+void
+SourceFile::close()
+{
+#ifndef _WIN32
+  if (mMapping != nullptr)
+    munmap(mMapping, mMappingSize);
+#endif
+
+  mMapping = nullptr;
+  mMappingSize = 0;
+  mBuffer.clear();
+  mBuffer.shrink_to_fit();
+  mData = nullptr;
+  mSize = 0;
+}
+
+std::string_view
+SourceFile::getView() const
+{
+  if (mData == nullptr)
+    return std::string_view();
+  return std::string_view(mData, mSize);
+}
+
+bool
+SourceFile::isMapped() const
+{
+  return mMapping != nullptr;
+}
+
+#ifdef _WIN32
+
+bool
+SourceFile::open(const std::string& fileName)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "SourceFile::open(" << fileName << ")";
+
+  close();
+
+  if (fileName == "-") {
+    mBuffer.assign(std::istreambuf_iterator<char>(std::cin),
+                   std::istreambuf_iterator<char>());
+  } else {
+    // Read the whole file with a single call instead of char by char
+    std::ifstream ifs(fileName.c_str(), std::ios::binary | std::ios::ate);
+    if (!ifs)
+      return false;
+    std::streamsize length = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    mBuffer.resize((size_t)length);
+    if (length > 0)
+      ifs.read(&mBuffer[0], length);
+  }
+
+  mData = mBuffer.data();
+  mSize = mBuffer.size();
+  return true;
+}
+
+#else
+
+bool
+SourceFile::open(const std::string& fileName)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "SourceFile::open(" << fileName << ")";
+
+  close();
+
+  // Read stdin into the fallback buffer
+  if (fileName == "-")
+    return readAll(STDIN_FILENO);
+
+  int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  // Only regular files can be mapped. Pipes, FIFOs and character devices are
+  // read into the fallback buffer
+  if (!S_ISREG(st.st_mode)) {
+    bool result = readAll(fd);
+    ::close(fd);
+    return result;
+  }
+
+  // Empty files can't be mapped, but they are valid (and empty) sources
+  if (st.st_size == 0) {
+    ::close(fd);
+    mData = "";
+    mSize = 0;
+    return true;
+  }
+
+  void* mapping =
+    mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  if (mapping == MAP_FAILED) {
+    MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT)
+      << "mmap failed for " << fileName << ". Reading file instead.";
+    bool result = readAll(fd);
+    ::close(fd);
+    return result;
+  }
+
+  // The mapping stays valid after closing the descriptor
+  ::close(fd);
+
+  // The parser scans the file exactly once from start to end
+  madvise(mapping, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+  mMapping = mapping;
+  mMappingSize = (size_t)st.st_size;
+  mData = (const char*)mapping;
+  mSize = mMappingSize;
+  return true;
+}
+
+bool
+SourceFile::readAll(int fd)
+{
+  char chunk[65536];
+
+  while (true) {
+    ssize_t n = ::read(fd, chunk, sizeof(chunk));
+    if (n > 0)
+      mBuffer.append(chunk, (size_t)n);
+    else if (n == 0)
+      break;
+    else if (errno != EINTR)
+      return false;
+  }
+
+  mData = mBuffer.data();
+  mSize = mBuffer.size();
+  return true;
+}
+
+#endif
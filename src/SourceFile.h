@@ -0,0 +1,83 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: SourceFile.h
+*	Author: Benjamin Wießneth
+*	Description: Read-only view of a VHDL source file. Regular files are
+*	memory-mapped, stdin and pipes are read into a buffer
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef SOURCEFILE_H
+#define SOURCEFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+class SourceFile
+{
+public:
+  // Creates an empty source file
+  SourceFile();
+
+  // Unmaps or frees the loaded contents
+  ~SourceFile();
+
+  SourceFile(const SourceFile&) = delete;
+  SourceFile& operator=(const SourceFile&) = delete;
+
+  // Loads the given file. A file name of "-" reads from stdin. Returns false
+  // if the file can't be opened
+  bool open(const std::string& fileName);
+
+  // Releases the current contents
+  void close();
+
+  // Returns a read-only view of the file contents. The view is valid until
+  // close() is called or the object is destroyed
+  std::string_view getView() const;
+
+  // Returns true if the contents are backed by a memory mapping
+  bool isMapped() const;
+
+private:
+#ifndef _WIN32
+  // Reads all remaining data of the given descriptor into mBuffer
+  bool readAll(int fd);
+#endif
+
+  // Start and size of the file contents
+  const char* mData;
+  size_t mSize;
+
+  // Address and length of the memory mapping, nullptr if not mapped
+  void* mMapping;
+  size_t mMappingSize;
+
+  // Fallback buffer for stdin, pipes and platforms without mmap
+  std::string mBuffer;
+};
+
+#endif
@@ -0,0 +1,295 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Stats.cpp
+*	Author: Benjamin Wießneth
+*	Description: Timing and counters reported with --stats
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "Stats.h"
+#include "OFileHandler.h"
+#include "VEC.h"
+
+#include <iomanip>
+
+#ifdef _WIN32
+#include <ctime>
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+thread_local Stats::PHASE Stats::currentPhase = PHASE::NUMBER_OF_PHASES;
+std::atomic<bool> Stats::enabled(false);
+Stats::Phase Stats::phases[(int)PHASE::NUMBER_OF_PHASES];
+std::atomic<unsigned long long> Stats::bytesRead(0);
+std::atomic<unsigned long long> Stats::bytesWritten(0);
+std::atomic<unsigned int> Stats::filesRead(0);
+
+// Process times of the whole run
+struct ProcessTimes
+{
+  double cpuMilliseconds;     // CPU time of VEC itself
+  double childMilliseconds;   // CPU time of LibreOffice
+  unsigned long long peakRSS; // Peak resident set size in KiB, 0 if unknown
+};
+
+static ProcessTimes
+getProcessTimes()
+{
+  ProcessTimes times = { 0, 0, 0 };
+#ifdef _WIN32
+  times.cpuMilliseconds = 1000.0 * std::clock() / CLOCKS_PER_SEC;
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    times.cpuMilliseconds = usage.ru_utime.tv_sec * 1000.0 +
+                            usage.ru_utime.tv_usec / 1000.0 +
+                            usage.ru_stime.tv_sec * 1000.0 +
+                            usage.ru_stime.tv_usec / 1000.0;
+    times.peakRSS = usage.ru_maxrss;
+  }
+  if (getrusage(RUSAGE_CHILDREN, &usage) == 0)
+    times.childMilliseconds = usage.ru_utime.tv_sec * 1000.0 +
+                              usage.ru_utime.tv_usec / 1000.0 +
+                              usage.ru_stime.tv_sec * 1000.0 +
+                              usage.ru_stime.tv_usec / 1000.0;
+#endif
+  return times;
+}
+
+// Converts ns to ms
+static double
+toMilliseconds(unsigned long long nanoseconds)
+{
+  return nanoseconds / 1e6;
+}
+
+Stats::Timer::Timer(PHASE phase, bool always)
+  : mPhase(phase)
+  , mPreviousPhase(currentPhase)
+  , mActive(always || enabled)
+  , mCPUStart(0)
+{
+  currentPhase = phase;
+  if (mActive) {
+    mWallStart = getWallTime();
+    mCPUStart = getThreadCPUTime();
+  }
+}
+
+Stats::Timer::~Timer()
+{
+  currentPhase = mPreviousPhase;
+  if (!mActive)
+    return;
+
+  Phase& phase = phases[(int)mPhase];
+  std::chrono::steady_clock::duration wallStop = getWallTime();
+  phase.threadNanoseconds +=
+    std::chrono::duration_cast<std::chrono::nanoseconds>(wallStop - mWallStart)
+      .count();
+  phase.cpuNanoseconds += getThreadCPUTime() - mCPUStart;
+  phase.calls++;
+
+  // Times are stored + 1 ns, so 0 marks a phase which wasn't started yet
+  unsigned long long start =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(mWallStart).count() +
+    1;
+  unsigned long long stop =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(wallStop).count() + 1;
+  unsigned long long first = phase.firstStart;
+  while (((first == 0) || (start < first)) &&
+         !phase.firstStart.compare_exchange_weak(first, start))
+    ;
+  unsigned long long last = phase.lastStop;
+  while ((stop > last) && !phase.lastStop.compare_exchange_weak(last, stop))
+    ;
+}
+
+void
+Stats::enable()
+{
+  enabled = true;
+}
+
+void
+Stats::addBytesRead(unsigned long long bytes)
+{
+  bytesRead += bytes;
+  filesRead++;
+}
+
+void
+Stats::addBytesWritten(unsigned long long bytes)
+{
+  bytesWritten += bytes;
+}
+
+long long
+Stats::getThreadCPUTime()
+{
+#ifdef _WIN32
+  return 0;
+#else
+  timespec time;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+    return 0;
+  return time.tv_sec * 1000000000LL + time.tv_nsec;
+#endif
+}
+
+const char*
+Stats::getPhaseName(PHASE phase)
+{
+  switch (phase) {
+    case PHASE::CONFIG:
+      return "config";
+    case PHASE::DISCOVER:
+      return "discover";
+    case PHASE::LOAD:
+      return "load";
+    case PHASE::PARSE:
+      return "parse";
+    case PHASE::LAYOUT:
+      return "layout";
+    case PHASE::FODG:
+      return "fodg";
+    case PHASE::SVG:
+      return "svg";
+    case PHASE::PNG:
+      return "png";
+    case PHASE::DOKUWIKI:
+      return "dokuwiki";
+    case PHASE::MARKDOWN:
+      return "markdown";
+    case PHASE::LATEX:
+      return "latex";
+    case PHASE::LIBREOFFICE:
+      return "libreoffice";
+    case PHASE::NUMBER_OF_PHASES:
+      break;
+  }
+  return "";
+}
+
+const char*
+Stats::getCurrentPhaseName()
+{
+  return getPhaseName(currentPhase);
+}
+
+double
+Stats::getElapsedMilliseconds()
+{
+  return std::chrono::duration<double, std::milli>(getWallTime()).count();
+}
+
+std::chrono::steady_clock::duration
+Stats::getWallTime()
+{
+  static const std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  return std::chrono::steady_clock::now() - start;
+}
+
+void
+Stats::printTable(std::ostream& os, unsigned int skippedSources)
+{
+  ProcessTimes times = getProcessTimes();
+  double wall =
+    std::chrono::duration<double, std::milli>(getWallTime()).count();
+
+  // Span is the wall time from the first start to the last stop of a phase,
+  // thread the summed wall time of all threads in it
+  os << std::fixed << std::setprecision(2) << std::left << std::setw(14)
+     << "Phase" << std::right << std::setw(12) << "Span [ms]" << std::setw(13)
+     << "Thread [ms]" << std::setw(12) << "CPU [ms]" << std::setw(8)
+     << "Calls" << "\n";
+
+  for (int i = 0; i < (int)PHASE::NUMBER_OF_PHASES; i++) {
+    const Phase& phase = phases[i];
+    if (phase.calls == 0)
+      continue;
+    os << std::left << std::setw(14) << getPhaseName((PHASE)i) << std::right
+       << std::setw(12) << toMilliseconds(phase.lastStop - phase.firstStart)
+       << std::setw(13) << toMilliseconds(phase.threadNanoseconds)
+       << std::setw(12) << toMilliseconds(phase.cpuNanoseconds)
+       << std::setw(8) << phase.calls << "\n";
+  }
+  os << std::left << std::setw(14) << "total" << std::right << std::setw(12)
+     << wall << std::setw(13) << "" << std::setw(12) << times.cpuMilliseconds
+     << "\n";
+  if (times.childMilliseconds > 0)
+    os << std::left << std::setw(14) << "child procs" << std::right
+       << std::setw(25) << "" << std::setw(12) << times.childMilliseconds
+       << "\n";
+
+  os << "\n"
+     << "Read:    " << filesRead << " files, " << bytesRead << " bytes\n"
+     << "Written: " << OFileHandler::getNumberOfWrittenFiles() << " files, "
+     << bytesWritten << " bytes, " << OFileHandler::getNumberOfUnchangedFiles()
+     << " unchanged\n"
+     << "Skipped: " << skippedSources << " sources up to date\n";
+  if (times.peakRSS != 0)
+    os << "Peak RSS: " << times.peakRSS << " KiB\n";
+
+  os << std::defaultfloat << std::flush;
+}
+
+void
+Stats::printJSON(std::ostream& os, unsigned int skippedSources)
+{
+  ProcessTimes times = getProcessTimes();
+  double wall =
+    std::chrono::duration<double, std::milli>(getWallTime()).count();
+
+  os << std::fixed << std::setprecision(3) << "{\"version\":\"" << VERSION
+     << "\",\"wall_ms\":" << wall << ",\"cpu_ms\":" << times.cpuMilliseconds
+     << ",\"child_cpu_ms\":" << times.childMilliseconds
+     << ",\"peak_rss_kib\":" << times.peakRSS << ",\"phases\":{";
+
+  bool first = true;
+  for (int i = 0; i < (int)PHASE::NUMBER_OF_PHASES; i++) {
+    const Phase& phase = phases[i];
+    if (phase.calls == 0)
+      continue;
+    os << (first ? "" : ",") << "\"" << getPhaseName((PHASE)i)
+       << "\":{\"span_ms\":"
+       << toMilliseconds(phase.lastStop - phase.firstStart)
+       << ",\"thread_ms\":" << toMilliseconds(phase.threadNanoseconds)
+       << ",\"cpu_ms\":" << toMilliseconds(phase.cpuNanoseconds)
+       << ",\"calls\":" << phase.calls << "}";
+    first = false;
+  }
+
+  os << "},\"files\":{\"read\":" << filesRead
+     << ",\"bytes_read\":" << bytesRead
+     << ",\"written\":" << OFileHandler::getNumberOfWrittenFiles()
+     << ",\"bytes_written\":" << bytesWritten
+     << ",\"unchanged\":" << OFileHandler::getNumberOfUnchangedFiles()
+     << ",\"skipped\":" << skippedSources << "}}" << std::endl
+     << std::defaultfloat;
+}
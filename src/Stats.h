@@ -0,0 +1,140 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Stats.h
+*	Author: Benjamin Wießneth
+*	Description: Timing and counters reported with --stats
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+// Timing and counters of a run, reported with "--stats" and "--stats-json".
+// All methods are thread-safe. Times are only measured once enable() was
+// called, so the timers cost nothing otherwise
+class Stats
+{
+public:
+  // Phases of a run. Each output format includes rendering and writing the
+  // file, the layout is measured separately
+  enum class PHASE
+  {
+    CONFIG,
+    DISCOVER,
+    LOAD,
+    PARSE,
+    LAYOUT,
+    FODG,
+    SVG,
+    PNG,
+    DOKUWIKI,
+    MARKDOWN,
+    LATEX,
+    LIBREOFFICE,
+    NUMBER_OF_PHASES
+  };
+
+  // Measures the wall and CPU time of the calling thread from construction to
+  // destruction and adds it to phase. Also extends the span of the phase,
+  // which runs from its first start to its last stop in any thread. The phase
+  // is the current phase of the thread meanwhile, even if stats aren't
+  // enabled
+  class Timer
+  {
+  public:
+    // If always is set the time is measured even if stats aren't enabled
+    // yet, e.g. while the config is loaded before the program options are
+    // parsed
+    Timer(PHASE phase, bool always = false);
+    ~Timer();
+
+  private:
+    PHASE mPhase;
+    PHASE mPreviousPhase;
+    bool mActive;
+    std::chrono::steady_clock::duration mWallStart;
+    long long mCPUStart;
+  };
+
+  // Starts measuring the timers
+  static void enable();
+  static bool isEnabled() { return enabled; };
+
+  // Adds the size of a loaded source file
+  static void addBytesRead(unsigned long long bytes);
+
+  // Adds the size of a written output file
+  static void addBytesWritten(unsigned long long bytes);
+
+  // Returns the name of the phase the calling thread is in or "" outside of
+  // all phases
+  static const char* getCurrentPhaseName();
+
+  // Returns the time since the start of the run in ms
+  static double getElapsedMilliseconds();
+
+  // Prints all phases and counters as a table
+  static void printTable(std::ostream& os, unsigned int skippedSources);
+
+  // Prints all phases and counters as a JSON object
+  static void printJSON(std::ostream& os, unsigned int skippedSources);
+
+private:
+  // Accumulated times of a phase. With several jobs the thread time is the
+  // sum of all threads, so it may exceed the span and the whole run
+  struct Phase
+  {
+    std::atomic<unsigned long long> threadNanoseconds;
+    std::atomic<unsigned long long> firstStart; // 0 if not started yet
+    std::atomic<unsigned long long> lastStop;
+    std::atomic<unsigned long long> cpuNanoseconds;
+    std::atomic<unsigned int> calls;
+  };
+
+  // Returns the CPU time of the calling thread in ns
+  static long long getThreadCPUTime();
+
+  // Returns the name of phase as used in the reports
+  static const char* getPhaseName(PHASE phase);
+
+  // Returns the time since the first call, which happens while the config is
+  // loaded during startup
+  static std::chrono::steady_clock::duration getWallTime();
+
+  // Innermost phase of the calling thread, NUMBER_OF_PHASES outside of all
+  static thread_local PHASE currentPhase;
+
+  static std::atomic<bool> enabled;
+  static Phase phases[(int)PHASE::NUMBER_OF_PHASES];
+  static std::atomic<unsigned long long> bytesRead;
+  static std::atomic<unsigned long long> bytesWritten;
+  static std::atomic<unsigned int> filesRead;
+};
+
+#endif
@@ -0,0 +1,182 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: ThreadPool.cpp
+*	Author: Benjamin Wießneth
+*	Description: Work-stealing thread pool used to process several source files
+*	concurrently
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "ThreadPool.h"
+#include "MSG.h"
+
+// Index of the queue owned by the current thread, -1 for non-worker threads
+static thread_local int workerIndex = -1;
+
+// Pool the current worker thread belongs to
+static thread_local ThreadPool* workerPool = nullptr;
+
+ThreadPool::ThreadPool(unsigned int numberOfThreads)
+  : mQueued(0)
+  , mPending(0)
+  , mNextQueue(0)
+  , mStop(false)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "ThreadPool::ThreadPool(" << numberOfThreads << ")";
+
+  if (numberOfThreads == 0)
+    numberOfThreads = getHardwareThreads();
+
+  // Create all queues before any worker starts stealing from them
+  for (unsigned int i = 0; i < numberOfThreads; i++)
+    mQueues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+
+  for (unsigned int i = 0; i < numberOfThreads; i++)
+    mThreads.push_back(std::thread(&ThreadPool::run, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "ThreadPool::~ThreadPool()";
+
+  wait();
+
+  {
+    std::lock_guard<std::mutex> guard(mLock);
+    mStop = true;
+  }
+  mWorkAvailable.notify_all();
+
+  for (unsigned int i = 0; i < mThreads.size(); i++)
+    mThreads[i].join();
+}
+
+unsigned int
+ThreadPool::getHardwareThreads()
+{
+  unsigned int n = std::thread::hardware_concurrency();
+  return (n == 0) ? 1 : n;
+}
+
+unsigned int
+ThreadPool::getNumberOfThreads()
+{
+  return mThreads.size();
+}
+
+void
+ThreadPool::submit(std::function<void()> task)
+{
+  // Keep tasks created by a worker local to that worker, this way a worker
+  // first finishes its own work before others have to steal it
+  unsigned int target;
+  if (workerPool == this)
+    target = workerIndex;
+  else
+    target = mNextQueue++ % mQueues.size();
+
+  // Count the task before it becomes visible, otherwise a worker could take
+  // it and decrement the counters first. Incrementing mQueued while holding
+  // mLock makes sure a worker about to sleep can't miss the wake-up
+  mPending++;
+  {
+    std::lock_guard<std::mutex> guard(mLock);
+    mQueued++;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(mQueues[target]->lock);
+    mQueues[target]->tasks.push_back(std::move(task));
+  }
+  mWorkAvailable.notify_one();
+}
+
+void
+ThreadPool::wait()
+{
+  std::unique_lock<std::mutex> guard(mLock);
+  mAllDone.wait(guard, [this] { return mPending == 0; });
+}
+
+bool
+ThreadPool::popTask(unsigned int self, std::function<void()>& task)
+{
+  // Newest task of the own queue first
+  {
+    std::lock_guard<std::mutex> guard(mQueues[self]->lock);
+    if (!mQueues[self]->tasks.empty()) {
+      task = std::move(mQueues[self]->tasks.back());
+      mQueues[self]->tasks.pop_back();
+      return true;
+    }
+  }
+
+  // Steal the oldest task of another worker
+  for (unsigned int i = 1; i < mQueues.size(); i++) {
+    WorkQueue& victim = *mQueues[(self + i) % mQueues.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void
+ThreadPool::run(unsigned int self)
+{
+  workerIndex = self;
+  workerPool = this;
+
+  std::function<void()> task;
+
+  while (true) {
+    {
+      // Sleep until a task is queued or the pool shuts down
+      std::unique_lock<std::mutex> guard(mLock);
+      mWorkAvailable.wait(guard, [this] { return mStop || mQueued > 0; });
+
+      if (mStop && mQueued == 0)
+        return;
+    }
+
+    if (!popTask(self, task))
+      continue;
+
+    mQueued--;
+    task();
+    task = nullptr;
+
+    // Wake up callers of wait() once the last task is done
+    if (--mPending == 0) {
+      std::lock_guard<std::mutex> guard(mLock);
+      mAllDone.notify_all();
+    }
+  }
+}
@@ -0,0 +1,102 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: ThreadPool.h
+*	Author: Benjamin Wießneth
+*	Description: Work-stealing thread pool used to process several source files
+*	concurrently
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+  // Creates a pool with the given number of worker threads. A value of 0 uses
+  // one worker per available hardware thread
+  ThreadPool(unsigned int numberOfThreads = 0);
+
+  // Waits for all queued tasks and joins the worker threads
+  ~ThreadPool();
+
+  // Queues a task. Tasks submitted from a worker thread are placed in that
+  // worker's own queue, all other tasks are distributed round-robin
+  void submit(std::function<void()> task);
+
+  // Blocks until all queued and running tasks are finished
+  void wait();
+
+  // Returns the number of worker threads
+  unsigned int getNumberOfThreads();
+
+  // Returns the number of hardware threads (at least 1)
+  static unsigned int getHardwareThreads();
+
+private:
+  // Task queue owned by a single worker. The owner pops from the back, idle
+  // workers steal from the front
+  struct WorkQueue
+  {
+    std::deque<std::function<void()>> tasks;
+    std::mutex lock;
+  };
+
+  // Main loop of each worker thread
+  void run(unsigned int self);
+
+  // Takes a task from the own queue or steals one from another worker
+  bool popTask(unsigned int self, std::function<void()>& task);
+
+  std::vector<std::unique_ptr<WorkQueue>> mQueues;
+  std::vector<std::thread> mThreads;
+
+  // Guards sleeping/waking of idle workers and waiting callers
+  std::mutex mLock;
+  std::condition_variable mWorkAvailable;
+  std::condition_variable mAllDone;
+
+  // Number of queued tasks which weren't picked up yet
+  std::atomic<unsigned int> mQueued;
+
+  // Number of queued and currently running tasks
+  std::atomic<unsigned int> mPending;
+
+  // Next queue used for round-robin distribution
+  std::atomic<unsigned int> mNextQueue;
+
+  bool mStop;
+};
+
+#endif
@@ -31,11 +31,15 @@
 
 #include "VEC.h"
 #include "Config.h"
+#include "Converter.h"
 #include "MSG.h"
-#include "OutputGenerator.h"
-#include "VHDLParser.h"
+#include "OFileHandler.h"
+#include "Server.h"
+#include "Stats.h"
+#include "Watcher.h"
 #include "tools.h"
 
+#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -66,42 +70,48 @@ main(int argc, const char* argv[])
   else {
     MSG(LOG_LEVEL::INFO) << "Verbose mode";
 
-    for (unsigned int i = 0; i < inputFiles.size(); i++) {
-      // Check if input argument has a vhdl extension
-      if (validFileExtension(inputFiles[i]) == true) {
-        std::cout << "Parsing " << inputFiles[i] << std::endl;
+    // Measure the phases of this run
+    const std::string statsFile = cfg.getString("VEC.statsJSON");
+    if (cfg.getBool("VEC.stats") || !statsFile.empty())
+      Stats::enable();
 
-        // Create parser object and parse the given source file
-        VHDLParser myParser(inputFiles[i]);
+    // Resolve the typed config values once the program options are applied
+    cfg.resolveSnapshot();
 
-        // Set the entity label. It's either provided via command line or
-        // defined in VEC.conf
-        myParser.setEntityLabel(cfg.getString("default_label"));
+    // Serve render requests until the process is terminated
+    if (!cfg.getString("VEC.server").empty())
+      return runServer(cfg.getString("VEC.server"), cfg.getInt("VEC.jobs"));
 
-        // Check if parsed entity has ports
-        if ((myParser.getEntity().getNumberOfInputs() == 0) &&
-            (myParser.getEntity().getNumberOfOutputs() == 0)) {
-          MSG(LOG_LEVEL::ERROR) << "Parsed VHDL entity has no valid ports.";
-        } else {
-          // Print short overview of parsed vhdl entity when verbose mode is
-          // active
-          myParser.printResults();
+    // Keep converting changed files until the process is terminated
+    if (!cfg.getString("VEC.watch").empty())
+      return watchSources(cfg.getString("VEC.watch"), inputFiles,
+                          cfg.getInt("VEC.jobs"));
 
-          std::cout << "Generating output files" << std::endl;
+    // Parse all source files and create the output files. The config object
+    // isn't modified from here on, so it's safe to be read by several jobs
+    unsigned int skipped = convertPaths(inputFiles, cfg.getInt("VEC.jobs"));
 
-          // Create a OutputGenerator object which takes care of creating the
-          // output files
-          OutputGenerator mOutputGenerator(inputFiles[i], myParser.getEntity());
-        }
-      } else {
-        // Print message if input file is no valid vhdl file
-        MSG(LOG_LEVEL::ERROR) << inputFiles[i]
-                              << " has no valid vhd extension. Supported "
-                                 "extensions are .vhd and .vhdl";
+    MSG::getStream() << "Done (" << OFileHandler::getNumberOfWrittenFiles()
+                     << " files written, "
+                     << OFileHandler::getNumberOfUnchangedFiles()
+                     << " unchanged, " << skipped << " sources up to date)"
+                     << std::endl;
+
+    if (cfg.getBool("VEC.stats")) {
+      MSG::getStream() << std::endl;
+      Stats::printTable(MSG::getStream(), skipped);
+    }
+    if (statsFile == "-") {
+      Stats::printJSON(MSG::getStream(), skipped);
+    } else if (!statsFile.empty()) {
+      std::ofstream json(statsFile.c_str());
+      Stats::printJSON(json, skipped);
+      if (!json) {
+        MSG(LOG_LEVEL::ERROR) << "Can't write stats file " << statsFile;
+        return 1;
       }
     }
   }
 
-  std::cout << "Done" << std::endl;
   return 0;
 }
@@ -51,7 +51,7 @@ VHDLEntity::VHDLEntity()
 {}
 
 void
-VHDLEntity::printEntityInfo()
+VHDLEntity::printEntityInfo() const
 {
   MSG(LOG_LEVEL::INFO) << "Entity structure:\n"
                        << INDENT << "Inputs: " << numberOfInputs << NL << INDENT
@@ -70,15 +70,15 @@ VHDLEntity::setEntityName(string eName)
 }
 
 EntityPort::portDirections
-VHDLEntity::getPortdirection(int portNumber)
+VHDLEntity::getPortdirection(int portNumber) const
 {
   return myPorts[portNumber].getPortDirection();
 }
 
 void
-VHDLEntity::appendPort(EntityPort newPort)
+VHDLEntity::appendPort(const EntityPort& newPort)
 {
-  myPorts.push_back(EntityPort(newPort));
+  myPorts.push_back(newPort);
   if (myPorts[numberOfPorts].getPortDirection() == EntityPort::IN)
     numberOfInputs++;
   if (myPorts[numberOfPorts].getPortDirection() == EntityPort::OUT)
@@ -91,128 +91,128 @@ VHDLEntity::appendPort(EntityPort newPort)
 }
 
 void
-VHDLEntity::appendGeneric(GenericSignal newGeneric)
+VHDLEntity::appendGeneric(const GenericSignal& newGeneric)
 {
-  myGenerics.push_back(GenericSignal(newGeneric));
+  myGenerics.push_back(newGeneric);
   numberOfGenerics++;
 }
 
 int
-VHDLEntity::getNumberOfInputs()
+VHDLEntity::getNumberOfInputs() const
 {
   return numberOfInputs;
 }
 
 int
-VHDLEntity::getNumberOfOutputs()
+VHDLEntity::getNumberOfOutputs() const
 {
   return numberOfOutputs;
 }
 
 int
-VHDLEntity::getNumberOfGenerics()
+VHDLEntity::getNumberOfGenerics() const
 {
   return numberOfGenerics;
 }
 
-string
-VHDLEntity::getPortName(int portNumber)
+const std::string&
+VHDLEntity::getPortName(int portNumber) const
 {
   return myPorts[portNumber].getPortLabel();
 }
 
-string
-VHDLEntity::getEntityName()
+const std::string&
+VHDLEntity::getEntityName() const
 {
   return entityName;
 }
 
 int
-VHDLEntity::getClockPort()
+VHDLEntity::getClockPort() const
 {
   return clockPort;
 }
 
 int
-VHDLEntity::getResetPort()
+VHDLEntity::getResetPort() const
 {
   return resetPort;
 }
 
 bool
-VHDLEntity::isVector(int i)
+VHDLEntity::isVector(int i) const
 {
   return myPorts[i].getVector();
 }
 
 int
-VHDLEntity::getVectorLength(int i)
+VHDLEntity::getVectorLength(int i) const
 {
   return myPorts[i].getVectorLength();
 }
 
 int
-VHDLEntity::getVectorStart(int i)
+VHDLEntity::getVectorStart(int i) const
 {
   return myPorts[i].getVectorStart();
 }
 
 int
-VHDLEntity::getVectorEnd(int i)
+VHDLEntity::getVectorEnd(int i) const
 {
   return myPorts[i].getVectorEnd();
 }
 
 bool
-VHDLEntity::getLOWActive(int i)
+VHDLEntity::getLOWActive(int i) const
 {
   return myPorts[i].getLOWActive();
 }
 
-string
-VHDLEntity::getPortTypeStr(int i)
+const std::string&
+VHDLEntity::getPortTypeStr(int i) const
 {
   return myPorts[i].getPortType();
 }
 
-string
-VHDLEntity::getGenericName(int genericNumber)
+const std::string&
+VHDLEntity::getGenericName(int genericNumber) const
 {
   return myGenerics[genericNumber].getGenericName();
 }
 
-string
-VHDLEntity::getGenericType(int genericNumber)
+const std::string&
+VHDLEntity::getGenericType(int genericNumber) const
 {
   return myGenerics[genericNumber].getGenericTypeStr();
 }
 
 bool
-VHDLEntity::getGenericIsVector(int genericNumber)
+VHDLEntity::getGenericIsVector(int genericNumber) const
 {
   return myGenerics[genericNumber].getIsVector();
 }
 
 int
-VHDLEntity::getGenericVectorLength(int genericNumber)
+VHDLEntity::getGenericVectorLength(int genericNumber) const
 {
   return myGenerics[genericNumber].getVectorLength();
 }
 
 int
-VHDLEntity::getGenericVectorStart(int genericNumber)
+VHDLEntity::getGenericVectorStart(int genericNumber) const
 {
   return myGenerics[genericNumber].getVectorStart();
 }
 
 int
-VHDLEntity::getGenericVectorEnd(int genericNumber)
+VHDLEntity::getGenericVectorEnd(int genericNumber) const
 {
   return myGenerics[genericNumber].getVectorEnd();
 }
 
-string
-VHDLEntity::getGenericDefaultValue(int genericNumber)
+const std::string&
+VHDLEntity::getGenericDefaultValue(int genericNumber) const
 {
   return myGenerics[genericNumber].getDefaultValue();
 }
@@ -236,25 +236,25 @@ VHDLEntity::setVectorStr(int i, string vStr)
 }
 
 string
-VHDLEntity::getVectorStr(int i)
+VHDLEntity::getVectorStr(int i) const
 {
   return myPorts[i].getVectorStr();
 }
 
 string
-VHDLEntity::getVectorRawStr(int i)
+VHDLEntity::getVectorRawStr(int i) const
 {
   return myPorts[i].getVectorRawStr();
 }
 
-string
-VHDLEntity::getVectorEndStr(int i)
+const std::string&
+VHDLEntity::getVectorEndStr(int i) const
 {
   return myPorts[i].getVectorEndStr();
 }
 
-string
-VHDLEntity::getVectorStartStr(int i)
+const std::string&
+VHDLEntity::getVectorStartStr(int i) const
 {
   return myPorts[i].getVectorStartStr();
 }
@@ -265,14 +265,14 @@ VHDLEntity::setEntityLabel(string eL)
   entityLabel = eL;
 }
 
-string
-VHDLEntity::getEntityLabel()
+const std::string&
+VHDLEntity::getEntityLabel() const
 {
   return entityLabel;
 }
 
 string
-VHDLEntity::getGenericStr(int i)
+VHDLEntity::getGenericStr(int i) const
 {
   return myGenerics[i].getGenericStr();
 }
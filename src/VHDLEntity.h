@@ -47,10 +47,10 @@ public:
   ~VHDLEntity();
 
   // Appends an EntityPort to a VHDLEntity object
-  void appendPort(EntityPort);
+  void appendPort(const EntityPort& newPort);
 
   // Appends an GenericSignal to a VHDLEntity object
-  void appendGeneric(GenericSignal);
+  void appendGeneric(const GenericSignal& newGeneric);
 
   // Sets the number of output ports for a VHDLEntity object
   void setNumberOfOutputs(int numberOfOutputs);
@@ -62,63 +62,63 @@ public:
   void setEntityName(std::string entityName);
 
   // Prints some info about self
-  void printEntityInfo();
+  void printEntityInfo() const;
 
   // Returns the number of input ports
-  int getNumberOfInputs();
+  int getNumberOfInputs() const;
 
   // Returns the number of output ports
-  int getNumberOfOutputs();
+  int getNumberOfOutputs() const;
 
   // Returns the number of generic signals
-  int getNumberOfGenerics();
+  int getNumberOfGenerics() const;
 
   // Returns the port name from given port number
-  std::string getPortName(int portNumber);
+  const std::string& getPortName(int portNumber) const;
 
   // Returns the entity name
-  std::string getEntityName();
+  const std::string& getEntityName() const;
 
   // Returns the reset property from given port number
-  int getResetPort();
+  int getResetPort() const;
 
   // Returns the clock property from given port number
-  int getClockPort();
+  int getClockPort() const;
 
   // Returns the port direction from given port number
-  EntityPort::portDirections getPortdirection(int portNumber);
+  EntityPort::portDirections getPortdirection(int portNumber) const;
 
   // Returns the isVector property from given port number
-  bool isVector(int i);
+  bool isVector(int i) const;
 
   // Returns the vector length from given port number
-  int getVectorLength(int i);
+  int getVectorLength(int i) const;
 
   // Returns the vector start value from given port number
-  int getVectorStart(int i);
+  int getVectorStart(int i) const;
 
   // Returns the vector end value from given port number
-  int getVectorEnd(int i);
+  int getVectorEnd(int i) const;
 
   // Returns the polarity from given port number
-  bool getLOWActive(int i);
+  bool getLOWActive(int i) const;
 
   // Returns the port type std::string from given port number
-  std::string getPortTypeStr(int i);
+  const std::string& getPortTypeStr(int i) const;
 
-  std::string getGenericName(int genericNumber);
+  const std::string& getGenericName(int genericNumber) const;
 
-  std::string getGenericType(int genericNumber);
+  const std::string& getGenericType(int genericNumber) const;
 
-  bool getGenericIsVector(int genericNumber);
+  bool getGenericIsVector(int genericNumber) const;
 
-  int getGenericVectorLength(int genericNumber);
+  int getGenericVectorLength(int genericNumber) const;
 
-  int getGenericVectorStart(int genericNumber);
+  int getGenericVectorStart(int genericNumber) const;
 
-  int getGenericVectorEnd(int genericNumber);
+  int getGenericVectorEnd(int genericNumber) const;
 
-  std::string getGenericDefaultValue(int genericNumber);
+  const std::string& getGenericDefaultValue(int genericNumber) const;
 
   void setVectorEndStr(int i, std::string vE);
 
@@ -126,19 +126,19 @@ public:
 
   void setVectorStr(int i, std::string vStr);
 
-  std::string getVectorStr(int i);
+  std::string getVectorStr(int i) const;
 
-  std::string getVectorStartStr(int i);
+  const std::string& getVectorStartStr(int i) const;
 
-  std::string getVectorEndStr(int i);
+  const std::string& getVectorEndStr(int i) const;
 
   void setEntityLabel(std::string eL);
 
-  std::string getEntityLabel();
+  const std::string& getEntityLabel() const;
 
-  std::string getGenericStr(int genericNumber);
+  std::string getGenericStr(int genericNumber) const;
 
-  std::string getVectorRawStr(int i);
+  std::string getVectorRawStr(int i) const;
 
 private:
   std::string entityName;
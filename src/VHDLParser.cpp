@@ -31,38 +31,31 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "VHDLParser.h"
+#include "CharScan.h"
 #include "Config.h"
 #include "MSG.h"
+#include "Stats.h"
 #include "tools.h"
 
-#include <cstring>  // strlen
+#include <cctype>   // isalnum, isspace
+#include <cstring>  // strlen, memchr
 #include <stdlib.h> // atoi
 #include <string>
+#include <utility> // move
 
 using namespace std;
 
-// entityName
-string eName;
-
-bool isVector = false;
-int vectorLength = 0;
-int vectorStart = 0;
-int vectorEnd = 0;
-
 const std::string VHDLParser::keywordENTITY = "ENTITY";
 const std::string VHDLParser::keywordPORT = "PORT";
 const std::string VHDLParser::keywordGENERIC = "GENERIC";
 const std::string VHDLParser::keywordEND = "END";
 
-EntityPort::portTypes readPortType;
-EntityPort::portDirections readPortDir;
-
 VHDLParser::~VHDLParser()
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "VHDLParser::~VHDLParser()";
 }
 
-VHDLParser::VHDLParser(std::string fileName)
+VHDLParser::VHDLParser(std::string fileName, unsigned long long* sourceHash)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "VHDLParser::VHDLParser(" << fileName << ")";
@@ -70,45 +63,85 @@ VHDLParser::VHDLParser(std::string fileName)
 
   currentSTATE = IDLE;
   flag = NONE;
+  fLength = 0;
+  mEntityStart = 0;
+  mIdentifierStart = 0;
+  mFailed = false;
   keywordENTITYcount = 0;
   charCountPORT = 0;
   charCountGENERIC = 0;
   charCountEND = 0;
   portSection = false;
   genericSection = false;
+  isVector = false;
+  vectorLength = 0;
+  vectorStart = 0;
+  vectorEnd = 0;
+  readPortDir = EntityPort::NONE;
 
   // Create result object
   result = VHDLEntity();
 
   // Special ports
-  keywordReset = cfg.getString("resetName");
-  keywordClock = cfg.getString("clockName");
+  const ConfigSnapshot& settings = cfg.getSnapshot();
+  keywordReset = settings.resetName;
+  keywordClock = settings.clockName;
 
   // Polarity suffixes
-  HIGHActiveSuffix = cfg.getString("HIGHActiveSuffix");
-  LOWActiveSuffix = cfg.getString("LOWActiveSuffix");
+  HIGHActiveSuffix = settings.highActiveSuffix;
+  LOWActiveSuffix = settings.lowActiveSuffix;
 
   if (!fileName.empty())
-    parseFile(fileName);
+    parseFile(fileName, sourceHash);
 }
 
 void
-VHDLParser::parseFile(std::string fileName)
+VHDLParser::parseFile(std::string fileName, unsigned long long* sourceHash)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "VHDLParser::parseFile(" << fileName << ")";
 
-  if ((result.getNumberOfInputs()) || (result.getNumberOfOutputs()) > 0)
+  if (!loadFile(fileName)) {
+    MSG(LOG_LEVEL::ERROR) << "Can't open source file " << fileName;
+    mFailed = true;
+    return;
+  }
+
+  parseBuffer(mSourceFile.getView());
+  if (sourceHash != nullptr)
+    *sourceHash = hashFNV1a(mSourceFile.getView());
+
+  // The mapping isn't needed anymore once the entity is parsed
+  mSourceFile.close();
+}
+
+void
+VHDLParser::parseBuffer(std::string_view source)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "VHDLParser::parseBuffer(" << source.size() << " bytes)";
+  Stats::Timer timer(Stats::PHASE::PARSE);
+
+  if (!mEntities.empty())
     MSG(LOG_LEVEL::WARNING) << "Parser - VHDLEnity result already contains data!";
 
-  loadFile(fileName);
+  mSource = source;
+  fLength = mSource.size();
+
   // Init common vars
   currentSTATE = SEARCH_ENTITY;
   vectorLength = -1;
   readPortDir = EntityPort::NONE;
 
-  // Loop through all chars in mSourceBuffer
-  for (int i = 0; i < fLength; i++) {
+  // Loop through all chars in mSource
+  for (size_t i = 0; i < fLength; i++) {
+    // Skip everything in front of the ENTITY keyword in bulk
+    if ((currentSTATE == SEARCH_ENTITY) && (keywordENTITYcount == 0)) {
+      i = skipToEntityCandidate(i);
+      if (i >= fLength)
+        break;
+    }
+
     // Check for comment and set flag accordingly
     if (isComment(i))
       continue;
@@ -130,7 +163,7 @@ VHDLParser::parseFile(std::string fileName)
         break;
 
       case SEARCH_LEFTPARENTHESIS:
-        if (toupper(mSourceBuffer[i]) == '(') {
+        if (toupper(mSource[i]) == '(') {
           if (flag == FOUND_GENERIC) {
             currentSTATE = SEARCH_GENERICS;
             flag = READ_IDENTIFIER;
@@ -150,7 +183,7 @@ VHDLParser::parseFile(std::string fileName)
       // section is reached when there's an right parenthesis followed by a
       // semicolon
       case SEARCH_IOPORTS:
-        switch (int(toupper(mSourceBuffer[i]))) {
+        switch (int(toupper(mSource[i]))) {
 
           // Tabulator
           case 9:
@@ -180,7 +213,7 @@ VHDLParser::parseFile(std::string fileName)
               clearBuffer();
               flag = SEARCH_TYPE;
             } else if (flag == READ_VECTORLENGTH) {
-              mParserBuffer += mSourceBuffer[i];
+              mParserBuffer += mSource[i];
             }
             break;
 
@@ -199,6 +232,7 @@ VHDLParser::parseFile(std::string fileName)
           case int(','):
             if (flag == READ_IDENTIFIER) {
               mParsedPortName.push_back(mParserBuffer);
+              mParsedPortStart.push_back(mIdentifierStart);
               clearBuffer();
             }
             break;
@@ -207,6 +241,7 @@ VHDLParser::parseFile(std::string fileName)
           case int(':'):
             if (flag == READ_IDENTIFIER) {
               mParsedPortName.push_back(mParserBuffer);
+              mParsedPortStart.push_back(mIdentifierStart);
               clearBuffer();
               flag = SEARCH_DIRECTION;
             }
@@ -292,6 +327,10 @@ VHDLParser::parseFile(std::string fileName)
             if (flag == FOUND_ENDCOMMENT)
               flag = READ_IDENTIFIER;
 
+            // Remember where a port name starts for messages
+            if ((flag == READ_IDENTIFIER) && mParserBuffer.empty())
+              mIdentifierStart = i;
+
             switch (flag) {
               case FOUND_COMMENT:
                 // Do nothing with comment
@@ -302,17 +341,17 @@ VHDLParser::parseFile(std::string fileName)
               case READ_VECTORLENGTH:
               default:
                 // Buffer chars
-                mParserBuffer += mSourceBuffer[i];
+                mParserBuffer += mSource[i];
                 break;
             }
         }
         break;
 
       case SEARCH_GENERICS:
-        switch (int(toupper(mSourceBuffer[i]))) {
+        switch (int(toupper(mSource[i]))) {
           case 32:
             if (flag == READ_VECTORLENGTH)
-              mParserBuffer += mSourceBuffer[i];
+              mParserBuffer += mSource[i];
           case 13:
           case 9:
             break;
@@ -426,7 +465,7 @@ VHDLParser::parseFile(std::string fileName)
 
             if ((flag == READ_IDENTIFIER) || (flag == READ_TYPE) ||
                 (flag == READ_DEFAULT) || (flag == READ_VECTORLENGTH))
-              mParserBuffer += mSourceBuffer[i];
+              mParserBuffer += mSource[i];
             break;
         }
 
@@ -437,22 +476,40 @@ VHDLParser::parseFile(std::string fileName)
     }
 
     if (currentSTATE == DONE) {
-      break;
+      appendEntity();
+
+      // Continue with the next entity declaration within the same source
+      i = findNextEntity(i + 1);
+      if (i >= fLength)
+        break;
+      mEntityStart = i + 1 - keywordENTITY.length();
+      currentSTATE = SEARCH_ENTITYNAME;
     }
   }
-  matchGenerics();
+
+  // Keep the entity which was parsed when the end of the source was reached.
+  // If no entity was found at all an empty one is kept.
+  if (currentSTATE != DONE)
+    appendEntity();
+
+  // Don't keep a view of a buffer which isn't owned by the parser
+  mSource = std::string_view();
+  fLength = 0;
 }
 
-void
+bool
 VHDLParser::loadFile(string fileName)
 {
   MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
     << "VHDLParser::loadFile(" << fileName << ")";
-  // load vhd source into global mSourceBuffer buffer
-  std::ifstream ifs((char*)fileName.c_str());
-  mSourceBuffer.assign((std::istreambuf_iterator<char>(ifs)),
-                       (std::istreambuf_iterator<char>()));
-  fLength = mSourceBuffer.length();
+  Stats::Timer timer(Stats::PHASE::LOAD);
+
+  // Map the vhd source (or read it if it's stdin or a pipe)
+  if (!mSourceFile.open(fileName))
+    return false;
+
+  Stats::addBytesRead(mSourceFile.getView().size());
+  return true;
 }
 
 void
@@ -465,7 +522,52 @@ VHDLParser::clearBuffer()
 void
 VHDLParser::printResults()
 {
-  result.printEntityInfo();
+  for (unsigned int i = 0; i < mEntities.size(); i++)
+    mEntities[i].printEntityInfo();
+}
+
+const VHDLEntity&
+VHDLParser::getEntity() const
+{
+  // Returned if nothing was parsed yet
+  static const VHDLEntity emptyEntity;
+
+  if (mEntities.empty())
+    return emptyEntity;
+  return mEntities.front();
+}
+
+void
+VHDLParser::appendEntity()
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL) << "VHDLParser::appendEntity()";
+
+  matchGenerics();
+  mEntities.push_back(std::move(result));
+
+  // Reset the parser for the next entity
+  result = VHDLEntity();
+  mPortStarts.clear();
+  entityName.clear();
+  flag = NONE;
+  keywordENTITYcount = 0;
+  charCountPORT = 0;
+  charCountGENERIC = 0;
+  charCountEND = 0;
+  portSection = false;
+  genericSection = false;
+  isVector = false;
+  vectorLength = -1;
+  vectorStart = 0;
+  vectorEnd = 0;
+  readPortDir = EntityPort::NONE;
+  mParsedPortName.clear();
+  mParsedPortStart.clear();
+  mParsedPortType.clear();
+  mParsedGenericDefaultValue.clear();
+  mParsedVectorStart.clear();
+  mParsedVectorEnd.clear();
+  clearBuffer();
 }
 
 void
@@ -518,6 +620,10 @@ VHDLParser::appendPort()
       result.appendPort(nP);
     }
 
+    // Names read outside of the port section have no position of their own
+    mPortStarts.push_back(i < mParsedPortStart.size() ? mParsedPortStart[i]
+                                                      : mEntityStart);
+
     checkClock = false;
     checkReset = false;
     checkLOWActive = false;
@@ -535,6 +641,7 @@ VHDLParser::appendPort()
 
   // Clear vars for intermediate parsing step
   mParsedPortName.clear();
+  mParsedPortStart.clear();
   mParsedPortType.clear();
 }
 
@@ -563,26 +670,27 @@ VHDLParser::appendGeneric()
 
   // Clear vars for intermediate parsing step
   mParsedPortName.clear();
+  mParsedPortStart.clear();
   mParsedPortType.clear();
   mParsedGenericDefaultValue.clear();
 
   clearBuffer();
 }
 
-// Checks mSourceBuffer for comments
+// Checks mSource for comments
 bool
-VHDLParser::isComment(int i)
+VHDLParser::isComment(size_t i)
 {
   // A dash sets flag for possible comment, another Dash sets comment flag
   // LineFeed terminates a comment
-  if (mSourceBuffer[i] == 10) {
+  if (mSource[i] == 10) {
     if (flag == FOUND_COMMENT)
       flag = FOUND_ENDCOMMENT;
     return false;
   } else if (flag == FOUND_COMMENT)
     return true;
   else if (flag != READ_VECTORLENGTH)
-    if (mSourceBuffer[i] == '-') {
+    if (mSource[i] == '-') {
       if (flag == FOUND_DASH) {
         flag = FOUND_COMMENT;
         return true;
@@ -596,15 +704,16 @@ VHDLParser::isComment(int i)
   return false;
 }
 
-// Checks mSourceBuffer for the ENTITY keyword
+// Checks mSource for the ENTITY keyword
 void
-VHDLParser::searchEntity(int i)
+VHDLParser::searchEntity(size_t i)
 {
   if (flag == FOUND_COMMENT) {
     return;
   } else {
-    if (toupper(mSourceBuffer[i]) == keywordENTITY[keywordENTITYcount]) {
+    if (toupper(mSource[i]) == keywordENTITY[keywordENTITYcount]) {
       if (keywordENTITYcount == keywordENTITY.length() - 1) {
+        mEntityStart = i + 1 - keywordENTITY.length();
         currentSTATE = SEARCH_ENTITYNAME;
       } else
         keywordENTITYcount++;
@@ -614,11 +723,100 @@ VHDLParser::searchEntity(int i)
   }
 }
 
-// Checks mSourceBuffer for the entity name
+// Counts the LineFeeds in front of i. Only called for messages, so the source
+// isn't tracked while parsing
+MSG::Position
+VHDLParser::getPosition(size_t i) const
+{
+  MSG::Position position = { 1, 1 };
+  for (size_t j = 0; (j < i) && (j < fLength); j++) {
+    if (mSource[j] == '\n') {
+      position.line++;
+      position.column = 1;
+    } else
+      position.column++;
+  }
+  return position;
+}
+
+// Returns the next position at or after i which may change the state while
+// searching for the ENTITY keyword. Inside a comment only the terminating
+// LineFeed matters. Outside of comments only 'E', 'e' and '-' do, every other
+// char just keeps keywordENTITYcount at zero.
+size_t
+VHDLParser::skipToEntityCandidate(size_t i)
+{
+  const char* first = mSource.data() + i;
+  const char* last = mSource.data() + fLength;
+
+  if (flag == FOUND_COMMENT) {
+    const void* lf = memchr(first, '\n', last - first);
+    return lf ? static_cast<const char*>(lf) - mSource.data() : fLength;
+  }
+
+  return findLetterOrChar(first, last, 'e', '-') - mSource.data();
+}
+
+// Searches mSource from position i for the next entity declaration. Other
+// than searchEntity() this only accepts ENTITY as a whole word at the start of
+// a statement, which skips "end entity name;" and direct instantiations like
+// "u0 : entity work.name". Returns the position of the last char of the
+// keyword or fLength if there's no further entity.
+size_t
+VHDLParser::findNextEntity(size_t i)
+{
+  const char* data = mSource.data();
+  bool statementStart = false;
+
+  while (i < fLength) {
+    char c = mSource[i];
+
+    if ((c == '-') && (i + 1 < fLength) && (mSource[i + 1] == '-')) {
+      // Skip comment
+      const void* lf = memchr(data + i, '\n', fLength - i);
+      if (lf == nullptr)
+        return fLength;
+      i = static_cast<const char*>(lf) - data + 1;
+    } else if (c == '"') {
+      // Skip string literal
+      const void* quote = memchr(data + i + 1, '"', fLength - i - 1);
+      if (quote == nullptr)
+        return fLength;
+      i = static_cast<const char*>(quote) - data + 1;
+      statementStart = false;
+    } else if (isalnum((unsigned char)c) || (c == '_')) {
+      // Read a whole word and compare it with the keyword
+      size_t start = i;
+      while ((i < fLength) &&
+             (isalnum((unsigned char)mSource[i]) || (mSource[i] == '_')))
+        i++;
+
+      if (statementStart && (i - start == keywordENTITY.length())) {
+        size_t j = 0;
+        while ((j < keywordENTITY.length()) &&
+               (toupper(mSource[start + j]) == keywordENTITY[j]))
+          j++;
+        if (j == keywordENTITY.length())
+          return i - 1;
+      }
+      statementStart = false;
+    } else {
+      if (c == ';')
+        statementStart = true;
+      else if (!isspace((unsigned char)c))
+        statementStart = false;
+      i++;
+    }
+  }
+
+  return fLength;
+}
+
+// Checks mSource for the entity name
 void
-VHDLParser::searchEntityName(int i)
+VHDLParser::searchEntityName(size_t i)
 {
-  switch (int(toupper(mSourceBuffer[i]))) {
+  switch (int(toupper(mSource[i]))) {
     // Stop reading entityname if tab or blank is found
     case 9:  // tab
     case 32: // blank
@@ -634,17 +832,17 @@ VHDLParser::searchEntityName(int i)
     default:
       // Begin to read in after first tab or blank after the keyword ENTITY
       flag = READ_ENTITYNAME;
-      mParserBuffer += mSourceBuffer[i];
+      mParserBuffer += mSource[i];
   }
   return;
 }
 
 // Checks for the PORT or GENERIC keyword
 void
-VHDLParser::searchPortOrGeneric(int i)
+VHDLParser::searchPortOrGeneric(size_t i)
 {
   if (portSection == false) {
-    if (toupper(mSourceBuffer[i]) == keywordPORT[charCountPORT]) {
+    if (toupper(mSource[i]) == keywordPORT[charCountPORT]) {
       if (charCountPORT == keywordPORT.length() - 1) {
         charCountPORT = 0;
         portSection = true;
@@ -660,7 +858,7 @@ VHDLParser::searchPortOrGeneric(int i)
   }
 
   if (genericSection == false) {
-    if (toupper(mSourceBuffer[i]) == keywordGENERIC[charCountGENERIC]) {
+    if (toupper(mSource[i]) == keywordGENERIC[charCountGENERIC]) {
       if (charCountGENERIC == keywordGENERIC.length() - 1) {
         charCountGENERIC = 0;
         genericSection = true;
@@ -678,7 +876,7 @@ VHDLParser::searchPortOrGeneric(int i)
   // Check for the keyword END
   // Ends the parsing of ports and generics declaration
   // This will also prevent empty output when parsing testbench files
-  if (toupper(mSourceBuffer[i]) == keywordEND[charCountEND]) {
+  if (toupper(mSource[i]) == keywordEND[charCountEND]) {
     if (charCountEND == keywordEND.length() - 1) {
       charCountEND = 0;
       currentSTATE = DONE;
@@ -748,7 +946,8 @@ VHDLParser::readVector(string vString,
 void
 VHDLParser::setEntityLabel(string eL)
 {
-  result.setEntityLabel(eL);
+  for (unsigned int i = 0; i < mEntities.size(); i++)
+    mEntities[i].setEntityLabel(eL);
 }
 
 // Tries to match the vector length declaration of ports with found a generic
@@ -814,8 +1013,9 @@ VHDLParser::matchGenerics()
       if ((result.getVectorStr(i) == result.getVectorRawStr(i)) &&
           (result.getVectorLength(i) == 0))
         MSG(LOG_LEVEL::WARNING)
-          << "Found no matching generic signal for vector "
-             "length. Using raw input.";
+          << getPosition(mPortStarts[i])
+          << "Found no matching generic signal for vector length of port "
+          << result.getPortName(i) << ". Using raw input.";
     }
   }
 }
@@ -31,9 +31,12 @@
 #ifndef VHDLParser_H
 #define VHDLParser_H
 
+#include "MSG.h"
+#include "SourceFile.h"
 #include "VHDLEntity.h"
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class VHDLParser
@@ -83,27 +86,39 @@ class VHDLParser
   };
 
 public:
-  // VHDLParser constructor for vhdl file
-  VHDLParser(std::string fileName);
+  // VHDLParser constructor for vhdl file. See parseFile() for sourceHash
+  VHDLParser(std::string fileName, unsigned long long* sourceHash = nullptr);
 
   // VHDLParser destructor
   ~VHDLParser();
 
-  // Processes a given source file
-  void parseFile(std::string fileName);
+  // Processes a given source file. If sourceHash is given it's set to the
+  // hashFNV1a() of the file content, so callers don't have to read it again
+  void parseFile(std::string fileName,
+                 unsigned long long* sourceHash = nullptr);
+
+  // Processes VHDL source code from a buffer. The buffer has to stay valid
+  // during the call only
+  void parseBuffer(std::string_view source);
+
+  // Returns true if the source file couldn't be opened
+  bool hasFailed() const { return mFailed; };
 
   // Prints info about the VHDLEntity from parsed source
   void printResults();
 
-  // Returns VHDLEntity from parsed source
-  VHDLEntity getEntity() { return result; };
+  // Returns the first VHDLEntity from parsed source
+  const VHDLEntity& getEntity() const;
+
+  // Returns all VHDLEntities from parsed source in order of appearance
+  const std::vector<VHDLEntity>& getEntities() const { return mEntities; };
 
-  // Sets the label of VHDLEntity to given parameter
+  // Sets the label of all VHDLEntities to given parameter
   void setEntityLabel(std::string eL);
 
 private:
-  // Loads mSourceBuffer buffer with contents of fileName
-  void loadFile(std::string fileName);
+  // Maps or loads the contents of fileName into mSourceFile
+  bool loadFile(std::string fileName);
 
   // Clears mParserBuffer
   void clearBuffer();
@@ -111,32 +126,63 @@ private:
   // Appends parsed data to the VHDLEntity result
   void appendPort();
 
+  // Moves the VHDLEntity result to mEntities and resets the parser
+  void appendEntity();
+
   void appendGeneric();
 
   // Checks if a comment is parsed at the moment
-  bool isComment(int i);
+  bool isComment(size_t i);
 
   // Checks for the ENTITY keyword
-  void searchEntity(int i);
+  void searchEntity(size_t i);
+
+  // Returns the next char position which is relevant for searchEntity()
+  size_t skipToEntityCandidate(size_t i);
+
+  // Returns the position of the next entity declaration
+  size_t findNextEntity(size_t i);
 
   // Parses the entity name
-  void searchEntityName(int i);
+  void searchEntityName(size_t i);
+
+  // Returns the line and column of char position i for messages
+  MSG::Position getPosition(size_t i) const;
 
   // Checks for the PORT or GENERIC keyword
-  void searchPortOrGeneric(int i);
+  void searchPortOrGeneric(size_t i);
 
   // Holds the length of the source file
-  int fLength;
+  size_t fLength;
 
   // parseBuffers
-  // Contains the source file
-  std::string mSourceBuffer;
+  // Memory-mapped or buffered source file
+  SourceFile mSourceFile;
+
+  // View of the source code which is currently parsed
+  std::string_view mSource;
+
+  // Char position of the ENTITY keyword of the entity which is parsed
+  size_t mEntityStart;
+
+  // Char position of the port name which is read and of the names in
+  // mParsedPortName
+  size_t mIdentifierStart;
+  std::vector<size_t> mParsedPortStart;
+
+  // Char positions of the port names of the entity which is parsed, in the
+  // order of its ports
+  std::vector<size_t> mPortStarts;
+
+  // The source file couldn't be opened
+  bool mFailed;
 
   // Working buffer
   std::string mParserBuffer;
 
   // Found VHDLEntity values
   VHDLEntity result;
+  std::vector<VHDLEntity> mEntities;
   std::string entityName;
 
   STATES currentSTATE;
@@ -170,6 +216,11 @@ private:
   std::string mParsedGenericDefaultValue;
   std::string mParsedVectorStart;
   std::string mParsedVectorEnd;
+  EntityPort::portDirections readPortDir;
+  bool isVector;
+  int vectorLength;
+  int vectorStart;
+  int vectorEnd;
 
   size_t charCountPORT;
   size_t charCountGENERIC;
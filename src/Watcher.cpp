@@ -0,0 +1,481 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Watcher.cpp
+*	Author: Benjamin Wießneth
+*	Description: Watches source files and regenerates changed entities
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#include "Watcher.h"
+#include "Config.h"
+#include "Converter.h"
+#include "MSG.h"
+#include "OFileHandler.h"
+#include "SourceDiscovery.h"
+#include "tools.h"
+
+#ifdef __linux__
+
+#include <filesystem>
+#include <map>
+#include <set>
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+// Time without further changes before the collected changes are converted
+static const int DEBOUNCE_MS = 50;
+
+// Changes reported for watched directories. Files are reported once they are
+// closed after writing or renamed into place, new directories when created
+static const uint32_t WATCH_MASK =
+  IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE;
+
+// Returns path without "." and ".." components, e.g. "./a.vhd" => "a.vhd"
+static std::string
+normalizePath(const std::filesystem::path& path)
+{
+  std::string normalized = path.lexically_normal().string();
+  return normalized.empty() ? "." : normalized;
+}
+
+// Returns the directory of filePath, e.g. "a.vhd" => "."
+static std::string
+getDirectory(const std::string& filePath)
+{
+  return normalizePath(std::filesystem::path(filePath).parent_path());
+}
+
+namespace {
+
+// Source files, their directories and the config file watched with inotify
+class SourceWatcher
+{
+public:
+  SourceWatcher(int fd)
+    : mFd(fd)
+    , mIncludes(SourceDiscovery::splitPatterns(cfg.getString("VEC.include")))
+    , mExcludes(SourceDiscovery::splitPatterns(cfg.getString("VEC.exclude")))
+  {}
+  ~SourceWatcher() { close(mFd); }
+
+  // Watches directory and its subdirectories. VHDL files found in them are
+  // added to the sources if they pass the "--include" and "--exclude"
+  // patterns like in SourceDiscovery, matched against their path within
+  // root. If changed is true they're also marked as changed
+  bool addTree(const std::string& directory,
+               bool changed,
+               const std::string& root = "");
+
+  // Watches a single source file
+  bool addFile(const std::string& filePath);
+
+  // Watches the config file
+  bool addConfigFile(const std::string& filePath);
+
+  // Blocks until a change was reported and no further change happened for
+  // DEBOUNCE_MS. Returns false if waiting failed
+  bool waitForChanges();
+
+  // All sources and the ones changed since the last conversion
+  std::set<std::string> sources;
+  std::set<std::string> changedSources;
+
+  // The config file changed
+  bool configChanged = false;
+
+  // Changes were lost because the event queue overflowed
+  bool overflow = false;
+
+private:
+  // Watched directory of a watch descriptor
+  struct Directory
+  {
+    std::string path;
+    bool recursive;   // All VHDL files and subdirectories are watched
+    std::string root; // Directory the patterns of recursive ones refer to
+  };
+
+  // Adds an inotify watch for directory
+  bool addWatch(const std::string& directory,
+                bool recursive,
+                const std::string& root = "");
+
+  // Returns true if path or one of its directories below root matches an
+  // exclude pattern
+  bool isExcluded(const std::string& path, const std::string& root) const;
+
+  // Returns true if path is a source file of the tree at root
+  bool isSource(const std::string& path, const std::string& root) const;
+
+  // Reads all pending events. Returns true if a watched file changed
+  bool readEvents();
+
+  // Updates the sources for a single event. Returns true if a watched file
+  // changed
+  bool handleEvent(const inotify_event& event);
+
+  int mFd;
+  std::map<int, Directory> mDirectories;
+  std::set<std::string> mFiles; // Files given on the command line
+  std::string mConfigFile;
+  std::vector<std::string> mIncludes;
+  std::vector<std::string> mExcludes;
+};
+
+bool
+SourceWatcher::addWatch(const std::string& directory,
+                        bool recursive,
+                        const std::string& root)
+{
+  int wd = inotify_add_watch(mFd, directory.c_str(), WATCH_MASK);
+  if (wd < 0) {
+    MSG(LOG_LEVEL::ERROR) << "Can't watch directory '" << directory
+                          << "': " << strerror(errno);
+    return false;
+  }
+
+  // Watching the same directory twice returns the same descriptor
+  auto inserted =
+    mDirectories.emplace(wd, Directory{ directory, recursive, root });
+  if (!inserted.second && recursive) {
+    Directory& watched = inserted.first->second;
+    if (!watched.recursive)
+      watched.root = root;
+    watched.recursive = true;
+  }
+
+  MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << "Watching '" << directory << "'";
+  return true;
+}
+
+// SourceDiscovery prunes excluded directories, so each of them is checked
+bool
+SourceWatcher::isExcluded(const std::string& path,
+                          const std::string& root) const
+{
+  if (mExcludes.empty())
+    return false;
+
+  std::string relative =
+    std::filesystem::path(path).lexically_relative(root).generic_string();
+  for (size_t end = relative.find('/'); end != std::string::npos;
+       end = relative.find('/', end + 1))
+    if (SourceDiscovery::matchAny(mExcludes, relative.substr(0, end)))
+      return true;
+  return SourceDiscovery::matchAny(mExcludes, relative);
+}
+
+bool
+SourceWatcher::isSource(const std::string& path, const std::string& root) const
+{
+  if (!validFileExtension(path) || isExcluded(path, root))
+    return false;
+  if (mIncludes.empty())
+    return true;
+
+  std::string relative =
+    std::filesystem::path(path).lexically_relative(root).generic_string();
+  return SourceDiscovery::matchAny(mIncludes, relative);
+}
+
+bool
+SourceWatcher::addTree(const std::string& directory,
+                       bool changed,
+                       const std::string& root)
+{
+  // Subdirectories created later keep the root of the whole tree
+  const std::string& treeRoot = root.empty() ? directory : root;
+
+  // The watch is added first, so files created while scanning aren't missed
+  if (!addWatch(directory, true, treeRoot))
+    return false;
+
+  std::error_code error;
+  std::filesystem::recursive_directory_iterator it(
+    directory, std::filesystem::directory_options::skip_permission_denied,
+    error);
+  for (; !error && (it != std::filesystem::recursive_directory_iterator());
+       it.increment(error)) {
+    std::string path = normalizePath(it->path());
+    if (it->is_directory(error)) {
+      if (isExcluded(path, treeRoot)) {
+        it.disable_recursion_pending();
+        continue;
+      }
+      if (!addWatch(path, true, treeRoot))
+        return false;
+    } else if (isSource(path, treeRoot)) {
+      sources.insert(path);
+      if (changed)
+        changedSources.insert(path);
+    }
+  }
+
+  if (error) {
+    MSG(LOG_LEVEL::ERROR) << "Can't read directory '" << directory
+                          << "': " << error.message();
+    return false;
+  }
+  return true;
+}
+
+bool
+SourceWatcher::addFile(const std::string& filePath)
+{
+  if (filePath == "-") {
+    MSG(LOG_LEVEL::ERROR) << "Can't watch the standard input";
+    return false;
+  }
+
+  std::string path = normalizePath(filePath);
+  mFiles.insert(path);
+  sources.insert(path);
+  return addWatch(getDirectory(path), false);
+}
+
+bool
+SourceWatcher::addConfigFile(const std::string& filePath)
+{
+  mConfigFile = normalizePath(filePath);
+  return addWatch(getDirectory(mConfigFile), false);
+}
+
+bool
+SourceWatcher::waitForChanges()
+{
+  pollfd request = { mFd, POLLIN, 0 };
+  int timeout = -1;
+
+  while (true) {
+    int ready = poll(&request, 1, timeout);
+    if (ready < 0) {
+      if (errno == EINTR)
+        continue;
+      MSG(LOG_LEVEL::ERROR) << "Waiting for changes failed: "
+                            << strerror(errno);
+      return false;
+    }
+
+    // Nothing happened since the last change
+    if (ready == 0)
+      return true;
+
+    if (readEvents())
+      timeout = DEBOUNCE_MS;
+  }
+}
+
+bool
+SourceWatcher::readEvents()
+{
+  alignas(inotify_event) char buffer[16384];
+  bool changed = false;
+
+  // The descriptor is non-blocking, so reading stops once all are consumed
+  ssize_t length;
+  while ((length = read(mFd, buffer, sizeof(buffer))) > 0) {
+    const inotify_event* event;
+    for (char* pos = buffer; pos < buffer + length;
+         pos += sizeof(inotify_event) + event->len) {
+      event = reinterpret_cast<const inotify_event*>(pos);
+      if (handleEvent(*event))
+        changed = true;
+    }
+  }
+
+  return changed;
+}
+
+bool
+SourceWatcher::handleEvent(const inotify_event& event)
+{
+  if (event.mask & IN_Q_OVERFLOW) {
+    overflow = true;
+    return true;
+  }
+
+  auto it = mDirectories.find(event.wd);
+  if (it == mDirectories.end())
+    return false;
+
+  // The directory was removed
+  if (event.mask & IN_IGNORED) {
+    mDirectories.erase(it);
+    return false;
+  }
+  if (event.len == 0)
+    return false;
+
+  const Directory& directory = it->second;
+  std::string path =
+    normalizePath(std::filesystem::path(directory.path) / event.name);
+  bool removed = event.mask & (IN_DELETE | IN_MOVED_FROM);
+
+  if (path == mConfigFile) {
+    if (!removed)
+      configChanged = true;
+    return !removed;
+  }
+
+  // Directories created inside a watched tree are watched as well
+  if (event.mask & IN_ISDIR) {
+    if (!directory.recursive || removed || isExcluded(path, directory.root))
+      return false;
+    addTree(path, true, directory.root);
+    return true;
+  }
+
+  // Editors create a file before writing it, it's converted once closed
+  if ((event.mask & IN_CREATE) || !validFileExtension(path))
+    return false;
+  // Files given on the command line are converted regardless of the patterns
+  if ((mFiles.find(path) == mFiles.end()) &&
+      !(directory.recursive && isSource(path, directory.root)))
+    return false;
+
+  if (removed) {
+    sources.erase(path);
+    changedSources.erase(path);
+  } else {
+    sources.insert(path);
+    changedSources.insert(path);
+  }
+  return true;
+}
+
+} // namespace
+
+// Converts the given files and prints the summary of this run
+static void
+convertSources(const std::vector<std::string>& fileList, unsigned int jobs)
+{
+  unsigned int written = OFileHandler::getNumberOfWrittenFiles();
+  unsigned int unchanged = OFileHandler::getNumberOfUnchangedFiles();
+
+  unsigned int skipped = convertFiles(fileList, jobs);
+
+  MSG::getStream() << "Done ("
+                   << OFileHandler::getNumberOfWrittenFiles() - written
+                   << " files written, "
+                   << OFileHandler::getNumberOfUnchangedFiles() - unchanged
+                   << " unchanged, " << skipped << " sources up to date)"
+                   << std::endl;
+}
+
+// Watches the source files and converts them whenever they change
+int
+watchSources(const std::string& directory,
+             const std::vector<std::string>& fileList,
+             unsigned int jobs)
+{
+  MSG(LOG_LEVEL::DEBUG, DEBUG::FUNCTIONCALL)
+    << "watchSources(" << directory << ", " << fileList.size() << " files, "
+    << jobs << " jobs)";
+
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) {
+    MSG(LOG_LEVEL::ERROR) << "Can't watch source files: " << strerror(errno);
+    return 1;
+  }
+  SourceWatcher watcher(fd);
+
+  if (!directory.empty() && !watcher.addTree(directory, false))
+    return 1;
+  // Directories given as source are watched like the --watch directory
+  for (const std::string& fileName : fileList) {
+    std::error_code error;
+    if (std::filesystem::is_directory(fileName, error)
+          ? !watcher.addTree(fileName, false)
+          : !watcher.addFile(fileName))
+      return 1;
+  }
+  if (!cfg.getFileName().empty() &&
+      !watcher.addConfigFile(cfg.getFileName()))
+    return 1;
+
+  convertSources(std::vector<std::string>(watcher.sources.begin(),
+                                          watcher.sources.end()),
+                 jobs);
+
+  MSG::getStream() << "Watching " << watcher.sources.size()
+                   << " source files for changes" << std::endl;
+
+  while (watcher.waitForChanges()) {
+    bool convertAll = false;
+
+    // Generators read the reloaded values from the snapshot
+    if (watcher.configChanged) {
+      watcher.configChanged = false;
+      if (cfg.reload()) {
+        MSG(LOG_LEVEL::INFO) << "Reloaded config file";
+        convertAll = true;
+      }
+    }
+
+    // Missed changes are found by the build manifest
+    if (watcher.overflow) {
+      watcher.overflow = false;
+      if (!directory.empty())
+        watcher.addTree(directory, false);
+      convertAll = true;
+    }
+
+    // "-MF" lists the rules of all sources in one file
+    if (!cfg.getSnapshot().depFilePath.empty())
+      convertAll = true;
+
+    const std::set<std::string>& files =
+      convertAll ? watcher.sources : watcher.changedSources;
+    std::vector<std::string> changedFiles;
+    for (const std::string& fileName : files)
+      if (std::filesystem::exists(fileName))
+        changedFiles.push_back(fileName);
+    watcher.changedSources.clear();
+
+    if (!changedFiles.empty())
+      convertSources(changedFiles, jobs);
+  }
+
+  return 1;
+}
+
+#else
+
+// Watches the source files and converts them whenever they change
+int
+watchSources(const std::string& directory,
+             const std::vector<std::string>& fileList,
+             unsigned int jobs)
+{
+  MSG(LOG_LEVEL::ERROR) << "Watching source files isn't supported on this "
+                           "platform";
+  return 1;
+}
+
+#endif
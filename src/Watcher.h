@@ -0,0 +1,50 @@
+/***************************************************************************\
+*   Copyright(C) 2014 University of Applied Sciences Augsburg
+*                     Benjamin Wießneth, Johann Faerber
+*   Email: benjamin.wiessneth@hs-augsburg.de
+*   Email: johann.faerber@hs-augsburg.de
+*
+*****************************************************************************
+*
+*	File: Watcher.h
+*	Author: Benjamin Wießneth
+*	Description: Watches source files and regenerates changed entities
+*
+*****************************************************************************
+*
+*	This file is part of VEC
+*	VEC is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published
+*	by the Free Software Foundation, either version 3 of the License,
+*	or (at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+\***************************************************************************/
+
+#ifndef WATCHER_H
+#define WATCHER_H
+
+#include <string>
+#include <vector>
+
+// Converts all VHDL files found in directory and its subdirectories together
+// with the given source files. Afterwards the process stays alive and waits
+// for changes of these files and the loaded config file. Bursts of changes,
+// e.g. from an editor or a git checkout, are collected until no further
+// change happens for a short time. Then only the changed sources are
+// converted again, or all of them if the config file changed.
+// Runs until the process is terminated. Returns non-zero if the files can't
+// be watched
+int
+watchSources(const std::string& directory,
+             const std::vector<std::string>& fileList,
+             unsigned int jobs);
+
+#endif
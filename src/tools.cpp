@@ -138,15 +138,36 @@ parseArgv(int argc, const char* argv[], std::vector<std::string>& fList)
   bool readMDOutputPath = false;
   bool readLaTeXOutputPath = false;
   bool readDBGLevel = false;
+  bool readJobs = false;
+  bool readDepFile = false;
+  bool readWatchDirectory = false;
+  bool readSocketPath = false;
+  bool readStatsFile = false;
+  bool readLogFile = false;
+  bool readInclude = false;
+  bool readExclude = false;
   bool readOptionValue = false;
   bool printHelp = false;
   cfg.setString("VEC.printHelp", "false");
+  cfg.setString("VEC.jobs", "1");
+  cfg.setString("VEC.fsync", "false");
+  cfg.setString("VEC.MD", "false");
+  cfg.setString("VEC.MF", "");
+  cfg.setString("VEC.watch", "");
+  cfg.setString("VEC.server", "");
+  cfg.setString("VEC.stats", "false");
+  cfg.setString("VEC.statsJSON", "");
+  cfg.setString("VEC.logJSON", "");
+  cfg.setString("VEC.include", "");
+  cfg.setString("VEC.exclude", "");
 
   // Loop through all arguments
   for (int currentArgCounter = 1; currentArgCounter < argc;
        currentArgCounter++) {
-    // Check if the current argv should be a option value
-    if (readOptionValue && argv[currentArgCounter][0] == '-') {
+    // Check if the current argv should be a option value. A single "-" is a
+    // valid value (stdout)
+    if (readOptionValue && argv[currentArgCounter][0] == '-' &&
+        argv[currentArgCounter][1] != '\0') {
       // Detected a new parameter instead => Error
       MSG(LOG_LEVEL::ERROR)
         << "Error in program arguments. Maybe missing a parameter? (Check "
@@ -218,6 +239,51 @@ parseArgv(int argc, const char* argv[], std::vector<std::string>& fList)
       readDBGLevel = true;
       readOptionValue = true;
       continue;
+    } else if ((strcmp(argv[currentArgCounter], "-j") == 0) ||
+               (strcmp(argv[currentArgCounter], "--jobs") == 0)) {
+      readJobs = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--fsync") == 0) {
+      cfg.setString("VEC.fsync", "true");
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--no-cache") == 0) {
+      cfg.setString("PATH.cache", "");
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "-MD") == 0) {
+      cfg.setString("VEC.MD", "true");
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "-MF") == 0) {
+      readDepFile = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--watch") == 0) {
+      readWatchDirectory = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--server") == 0) {
+      readSocketPath = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--stats") == 0) {
+      cfg.setString("VEC.stats", "true");
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--stats-json") == 0) {
+      readStatsFile = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--log-json") == 0) {
+      readLogFile = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--include") == 0) {
+      readInclude = true;
+      readOptionValue = true;
+      continue;
+    } else if (strcmp(argv[currentArgCounter], "--exclude") == 0) {
+      readExclude = true;
+      readOptionValue = true;
+      continue;
     } else if ((strcmp(argv[currentArgCounter], "--help") == 0) ||
                (strcmp(argv[currentArgCounter], "-h") == 0) ||
                (strcmp(argv[currentArgCounter], "-?") == 0)) {
@@ -256,6 +322,51 @@ parseArgv(int argc, const char* argv[], std::vector<std::string>& fList)
       readLabel = false;
       readOptionValue = false;
       cfg.setString("default_label", argv[currentArgCounter]);
+    } else if (readDepFile) {
+      readDepFile = false;
+      readOptionValue = false;
+      cfg.setString("VEC.MF", argv[currentArgCounter]);
+    } else if (readWatchDirectory) {
+      readWatchDirectory = false;
+      readOptionValue = false;
+      cfg.setString("VEC.watch", argv[currentArgCounter]);
+    } else if (readSocketPath) {
+      readSocketPath = false;
+      readOptionValue = false;
+      cfg.setString("VEC.server", argv[currentArgCounter]);
+    } else if (readStatsFile) {
+      readStatsFile = false;
+      readOptionValue = false;
+      cfg.setString("VEC.statsJSON", argv[currentArgCounter]);
+    } else if (readLogFile) {
+      readLogFile = false;
+      readOptionValue = false;
+      cfg.setString("VEC.logJSON", argv[currentArgCounter]);
+      // All following messages are printed as JSON
+      if (!MSG::setJSONOutput(argv[currentArgCounter])) {
+        MSG(LOG_LEVEL::ERROR)
+          << "Can't open log file " << argv[currentArgCounter];
+        return 1;
+      }
+    } else if (readInclude || readExclude) {
+      // Both options may be given several times
+      const char* key = readInclude ? "VEC.include" : "VEC.exclude";
+      std::string patterns = cfg.getString(key);
+      cfg.setString(key, patterns + (patterns.empty() ? "" : ";") +
+                           argv[currentArgCounter]);
+      readInclude = false;
+      readExclude = false;
+      readOptionValue = false;
+    } else if (readJobs) {
+      readJobs = false;
+      readOptionValue = false;
+      if (isdigit(argv[currentArgCounter][0])) {
+        cfg.setString("VEC.jobs", argv[currentArgCounter]);
+      } else {
+        MSG(LOG_LEVEL::ERROR)
+          << "No valid number of jobs specified. -j <NUMBER>";
+        return 1;
+      }
     } else if (readDBGLevel) {
       readDBGLevel = false;
       readOptionValue = false;
@@ -273,6 +384,10 @@ parseArgv(int argc, const char* argv[], std::vector<std::string>& fList)
             break;
           case 3:
             MSG::setLogLevel(LOG_LEVEL::DEBUG);
+#ifdef VEC_STRIP_DEBUG
+            MSG(LOG_LEVEL::WARNING)
+              << "Debug messages aren't available in this build";
+#endif
             break;
         }
       } else {
@@ -318,14 +433,30 @@ parseArgv(int argc, const char* argv[], std::vector<std::string>& fList)
     << (MSG::getLogLevel() != LOG_LEVEL::ERROR ? "true" : "false")
     << " (MsgLevel = " << MSG::getLogLevelAsInt() << ")" << NL << INDENT
     << "-dbg " << (MSG::getDebugLevel() != DEBUG::NONE ? "true" : "false")
-    << " (DebugLevel = " << MSG::getDebugLevelAsInt() << ")";
+    << " (DebugLevel = " << MSG::getDebugLevelAsInt() << ")" << NL << INDENT
+    << "-j " << cfg.getInt("VEC.jobs") << NL << INDENT << "--fsync "
+    << (cfg.getBool("VEC.fsync") == true ? "true" : "false") << NL << INDENT
+    << "--no-cache "
+    << (cfg.getString("PATH.cache").empty() ? "true" : "false") << NL << INDENT
+    << "-MD "
+    << (cfg.getBool("VEC.MD") == true ? "true" : "false") << " -MF \""
+    << cfg.getString("VEC.MF") << "\"" << NL << INDENT << "--watch \""
+    << cfg.getString("VEC.watch") << "\"" << NL << INDENT << "--server \""
+    << cfg.getString("VEC.server") << "\"" << NL << INDENT << "--stats "
+    << (cfg.getBool("VEC.stats") == true ? "true" : "false")
+    << " --stats-json \"" << cfg.getString("VEC.statsJSON") << "\"" << NL
+    << INDENT << "--log-json \"" << cfg.getString("VEC.logJSON") << "\"" << NL
+    << INDENT << "--include \"" << cfg.getString("VEC.include")
+    << "\" --exclude \"" << cfg.getString("VEC.exclude") << "\"";
 
   for (unsigned int i = 0; i < fList.size(); i++) {
     MSG(LOG_LEVEL::DEBUG, DEBUG::RESULT) << INDENT << "SOURCE " << fList[i];
   }
 
-  // If no source filepath was found pop an error
-  if ((fList.size() == 0) && !printHelp) {
+  // If no source filepath was found pop an error. A watched directory
+  // provides the source files itself, the server receives them from clients
+  if ((fList.size() == 0) && cfg.getString("VEC.watch").empty() &&
+      cfg.getString("VEC.server").empty() && !printHelp) {
     MSG(LOG_LEVEL::ERROR) << "Error in program arguments. Missing source file";
     return 1;
   }
@@ -351,13 +482,21 @@ printInfo()
 void
 printHelp()
 {
+  // Messages of the program options are printed first
+  MSG::flush();
+
   std::cout << "VEC SOURCE [-l label] [-d] [-do DWPath] [-f] [-fo "
                "FODGPath] [-m] [-mo MDPath] [-p] [-po PNGPath] [-s] "
-               "[-so SVGPath] [-t] [-to LaTeXPath] [-v] [-dbg level]"
+               "[-so SVGPath] [-t] [-to LaTeXPath] [-v] [-dbg level] "
+               "[-j jobs] [--fsync] [--no-cache] [-MD] [-MF depfile] "
+               "[--watch dir] [--server socket] [--stats] "
+               "[--stats-json file] [--log-json file] [--include glob] "
+               "[--exclude glob]"
             << std::endl;
   std::cout
     << NL << std::setw(10) << std::left << "SOURCE"
-    << "Specify a VHD or VHDL as source file"
+    << "Specify a VHD or VHDL as source file or a directory to search "
+       "('-' reads from stdin)"
     << NL
     //<< std::setw(10) << std::left << "-c" << "Specify a config file to use"
     //<<
@@ -385,7 +524,39 @@ printHelp()
     << std::left << "-v"
     << "Set verbose mode" << NL << std::setw(10) << std::left << "-dbg"
     << "Enter Debug mode at specified level" << NL << std::setw(10) << std::left
-    << "-help"
+    << "-j"
+    << "Number of files converted in parallel (0 = all cores)" << NL
+    << std::setw(10) << std::left << "--fsync"
+    << "Flush each output file to disk before closing it" << NL
+    << std::setw(10) << std::left << "--no-cache"
+    << "Convert all files, even if they didn't change since the last run"
+    << NL << INDENT
+    << "(tracked in PATH.cache, relative to the working directory)" << NL
+    << std::setw(10) << std::left << "-MD"
+    << "Write a make dependency file (.d) next to each source file" << NL
+    << std::setw(10) << std::left << "-MF"
+    << "Write the make dependencies of all source files to this file" << NL
+    << std::setw(10) << std::left << "--watch"
+    << "Convert the files of a directory again whenever they change" << NL
+    << std::setw(10) << std::left << "--server"
+    << "Render requests received on this Unix domain socket" << NL
+    << std::setw(10) << std::left << "--stats"
+    << "Print the time of each phase and the number of files and bytes" << NL
+    << std::setw(10) << std::left << "--stats-json"
+    << "Write the same report as JSON to this file ('-' for stdout)" << NL
+    << std::setw(10) << std::left << "--log-json"
+    << "Write messages as JSON lines to this file ('-' for stdout, the "
+       "other output goes to stderr then)"
+    << NL
+    << std::setw(10) << std::left << "--include"
+    << "Only convert VHDL files of SOURCE directories matching this "
+       "pattern"
+    << NL
+    << std::setw(10) << std::left << "--exclude"
+    << "Skip files and directories of SOURCE directories matching this "
+       "pattern"
+    << NL
+    << std::setw(10) << std::left << "-help"
     << "Print this message" << NL;
 
   printLicense();
@@ -432,3 +603,13 @@ replaceStr(std::string source, std::string from, std::string to)
   }
   return source;
 }
+
+unsigned long long
+hashFNV1a(std::string_view data, unsigned long long hash)
+{
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
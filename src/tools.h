@@ -33,6 +33,7 @@
 
 #include <stdio.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 extern std::string configFile;           // Path of the config file
@@ -76,4 +77,10 @@ replaceAll(std::string& str, const std::string& from, const std::string& to);
 
 std::string
 replaceStr(std::string source, std::string from, std::string to);
+
+// Returns the 64 bit FNV-1a hash of data. Pass a previous result as hash to
+// continue hashing
+unsigned long long
+hashFNV1a(std::string_view data,
+          unsigned long long hash = 14695981039346656037ULL);
 #endif
\ No newline at end of file